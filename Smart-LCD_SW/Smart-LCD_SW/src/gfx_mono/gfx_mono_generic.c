@@ -70,6 +70,11 @@ void gfx_mono_generic_draw_horizontal_line(gfx_coord_t x, gfx_coord_t y,
 	uint8_t pixelmask;
 	uint8_t temp;
 
+	/* Nothing visible right of the display */
+	if (x >= GFX_MONO_LCD_WIDTH) {
+		return;
+	}
+
 	/* Clip line length if too long */
 	if (x + length > GFX_MONO_LCD_WIDTH) {
 		length = GFX_MONO_LCD_WIDTH - x;
@@ -181,7 +186,7 @@ void gfx_mono_generic_draw_line(gfx_coord_t x1, gfx_coord_t y1,
 		gfx_coord_t x2, gfx_coord_t y2,
 		enum gfx_mono_color color)
 {
-	uint8_t i;
+	uint16_t i;						/* dx or dy of 255 must not wrap */
 	uint8_t x;
 	uint8_t y;
 	int16_t xinc;
@@ -280,11 +285,16 @@ void gfx_mono_generic_draw_filled_rect(gfx_coord_t x, gfx_coord_t y,
 		gfx_coord_t width, gfx_coord_t height,
 		enum gfx_mono_color color)
 {
-	if (height == 0) {
+	if ((height == 0) || (y >= GFX_MONO_LCD_HEIGHT)) {
 		/* Nothing to do. Move along. */
 		return;
 	}
 
+	/* Clip height - rows below the display would wrap around the coordinate */
+	if (height > GFX_MONO_LCD_HEIGHT - y) {
+		height = GFX_MONO_LCD_HEIGHT - y;
+	}
+
 	while (height-- > 0) {
 		gfx_mono_draw_horizontal_line(x, y + height, width, color);
 	}
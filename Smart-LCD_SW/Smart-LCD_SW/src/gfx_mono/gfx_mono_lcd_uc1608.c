@@ -46,14 +46,61 @@
 #include "lcd.h"
 
 #include "gfx_mono_lcd_uc1608.h"
+#include "gfx_mono_text.h"
 
 
 gfx_mono_lcd_uc1608_cache_data_t g_gfx_mono_lcd_uc1608_cache = { 0 };
 
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+/* Mirror of the shadow pages, accessed by the framebuffer module */
+static uint8_t gfx_mono_lcd_uc1608_shadow[GFX_MONO_LCD_UC1608_SHADOW_PAGES * GFX_MONO_LCD_WIDTH];
+static bool gfx_mono_lcd_uc1608_shadow_valid = false;
+#endif
+
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+/* Dirty rectangles of the framebuffer: column range of each page not written to the display device yet */
+static uint16_t gfx_mono_lcd_uc1608_fb_dirty_pages = 0;
+static uint8_t gfx_mono_lcd_uc1608_fb_dirty_min[GFX_MONO_LCD_PAGES];
+static uint8_t gfx_mono_lcd_uc1608_fb_dirty_max[GFX_MONO_LCD_PAGES];
+#endif
+
+/* Run of consecutive columns of a page with the pixel masks collected for them */
+typedef struct gfx_mono_lcd_uc1608_run {
+	uint8_t			page;
+	uint8_t			column;
+	uint8_t			len;
+	uint8_t			masks[LCD_BUS_BURST_CHUNK];
+} gfx_mono_lcd_uc1608_run_t;
+
+/* Scratch table of pixel masks, sorted by page and column */
+typedef struct gfx_mono_lcd_uc1608_points {
+	uint8_t			len;
+	uint16_t		adr[GFX_MONO_LCD_UC1608_POINTS];				// (page << 8) | column
+	uint8_t			masks[GFX_MONO_LCD_UC1608_POINTS];
+} gfx_mono_lcd_uc1608_points_t;
+
 /* forward-declarations */
 static uint16_t gfx_mono_lcd_uc1608_cache_calc_adr(uint8_t page, uint8_t column);
-static void gfx_mono_lcd_uc1608_cache_write_byte(uint8_t page, uint8_t column, uint8_t data);
+static uint8_t gfx_mono_lcd_uc1608_cache_calc_idx(uint8_t page, uint8_t column);
+static void gfx_mono_lcd_uc1608_cache_write_byte(uint8_t page, uint8_t column, uint8_t data, bool dirty);
 static bool gfx_mono_lcd_uc1608_cache_read_byte(uint8_t page, uint8_t column, uint8_t* data);
+static void gfx_mono_lcd_uc1608_put_bitmap_shifted(struct gfx_mono_bitmap *bitmap, gfx_coord_t x, gfx_coord_t y);
+static uint8_t gfx_mono_lcd_uc1608_cache_src_byte(const uint8_t *src, uint16_t off, uint8_t type);
+static void gfx_mono_lcd_uc1608_cache_flush_entries(void);
+static void gfx_mono_lcd_uc1608_run_add(gfx_mono_lcd_uc1608_run_t *run, gfx_coord_t x, gfx_coord_t y, gfx_mono_color_t color);
+static void gfx_mono_lcd_uc1608_run_flush(gfx_mono_lcd_uc1608_run_t *run, gfx_mono_color_t color);
+static void gfx_mono_lcd_uc1608_points_add(gfx_mono_lcd_uc1608_points_t *points, gfx_coord_t x, gfx_coord_t y, gfx_mono_color_t color);
+static void gfx_mono_lcd_uc1608_points_flush(gfx_mono_lcd_uc1608_points_t *points, gfx_mono_color_t color);
+static void gfx_mono_lcd_uc1608_circle_extents(gfx_coord_t radius, uint8_t dist_min, uint8_t *extents);
+static void gfx_mono_lcd_uc1608_circle_masks(uint8_t page, int16_t col_first, int16_t col_last, const int16_t *row_left, const int16_t *row_right, gfx_mono_color_t color);
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+static void gfx_mono_lcd_uc1608_shadow_load(void);
+static void gfx_mono_lcd_uc1608_shadow_written(uint16_t start, const uint8_t *src, uint16_t len, uint8_t type);
+#endif
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+static void gfx_mono_lcd_uc1608_fb_dirty_mark(uint8_t page, uint8_t column, uint8_t width);
+static void gfx_mono_lcd_uc1608_fb_flush(void);
+#endif
 
 
 /**
@@ -76,21 +123,20 @@ void gfx_mono_lcd_uc1608_put_page(gfx_mono_color_t *data, gfx_coord_t page, gfx_
 		(page					<  GFX_MONO_LCD_PAGES) &&
 	    (page_offset			<  GFX_MONO_LCD_WIDTH)) {
 
-		gfx_mono_color_t *data_pt = data;
-
-		lcd_page_set(page);
-		lcd_col_set(page_offset);
-
 		if (page_offset + width > GFX_MONO_LCD_WIDTH) {
 			width = GFX_MONO_LCD_WIDTH - page_offset;
 		}
 
-		for (uint8_t cnt = width; cnt; --cnt) {
-			lcd_bus_write_ram(*(data_pt++));						// Write byte slice to LCD panel
+		if (width) {
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+			gfx_mono_lcd_uc1608_shadow_load();
+			gfx_mono_framebuffer_put_page(data, GFX_MONO_LCD_UC1608_SHADOW_PAGE(page), page_offset, width);
+			gfx_mono_lcd_uc1608_fb_dirty_mark(page, page_offset, width);	// Written to the LCD panel with the next frame
+#else
+			lcd_stream_window(page_offset, page, page_offset + width - 1, page, data);	// Write byte slices to LCD panel
+#endif
 		}
 	}
-
-	gfx_mono_lcd_uc1608_cache_clear();
 }
 
 /**
@@ -107,21 +153,239 @@ void gfx_mono_lcd_uc1608_get_page(gfx_mono_color_t *data, gfx_coord_t page, gfx_
 	(page					<  GFX_MONO_LCD_PAGES) &&
 	(page_offset			<  GFX_MONO_LCD_WIDTH)) {
 
-		gfx_mono_color_t *data_pt = data;
+		gfx_mono_lcd_uc1608_cache_flush_entries();					// Pending pixels of the cache go first
+
+		if (page_offset + width > GFX_MONO_LCD_WIDTH) {
+			width = GFX_MONO_LCD_WIDTH - page_offset;
+		}
+
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+		if (GFX_MONO_LCD_UC1608_SHADOWED(page)) {
+			if (width) {
+				gfx_mono_lcd_uc1608_shadow_load();
+				gfx_mono_framebuffer_get_page(data, GFX_MONO_LCD_UC1608_SHADOW_PAGE(page), page_offset, width);
+			}
+			return;
+		}
+#endif
 
 		lcd_page_set(page);
 		lcd_col_set(page_offset);
+		lcd_bus_read_ram_burst(data, width);						// Read byte slices from LCD panel, one dummy read only
+	}
+}
 
-		if (page_offset + width > GFX_MONO_LCD_WIDTH) {
-			width = GFX_MONO_LCD_WIDTH - page_offset;
+/**
+ * \brief Put a bitmap to the LCD controller memory
+ *
+ * At a page boundary the bitmap is streamed as one window. At any other y
+ * coordinate each source column is shifted across two destination pages:
+ * the partially covered top and bottom pages are merged with their content
+ * by one read/modify/write span each, the inner pages are written with
+ * plain burst writes. Parts outside of the display area are clipped.
+ *
+ * \param bitmap Pointer to the bitmap
+ * \param x      X coordinate of the upper left corner
+ * \param y      Y coordinate of the upper left corner
+ */
+void gfx_mono_lcd_uc1608_put_bitmap(struct gfx_mono_bitmap *bitmap, gfx_coord_t x, gfx_coord_t y)
+{
+	gfx_coord_t page	= y / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	gfx_coord_t pages	= bitmap->height / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	gfx_coord_t width	= bitmap->width;
+
+	if ((x >= GFX_MONO_LCD_WIDTH) || (page >= GFX_MONO_LCD_PAGES) || !pages || !width) {
+		return;
+	}
+
+	if (y % GFX_MONO_LCD_PIXELS_PER_BYTE) {
+		gfx_mono_lcd_uc1608_put_bitmap_shifted(bitmap, x, y);
+		return;
+	}
+
+	if (pages > GFX_MONO_LCD_PAGES - page) {
+		pages = GFX_MONO_LCD_PAGES - page;
+	}
+	if (width > GFX_MONO_LCD_WIDTH - x) {
+		width = GFX_MONO_LCD_WIDTH - x;
+	}
+
+	if (width == bitmap->width) {
+		/* One window for all pages */
+		if (bitmap->type == GFX_MONO_BITMAP_PROGMEM) {
+			lcd_stream_window_P(x, page, x + width - 1, page + pages - 1, bitmap->data.progmem);
+		} else {
+			lcd_stream_window(x, page, x + width - 1, page + pages - 1, bitmap->data.pixmap);
 		}
 
-		for (uint8_t cnt = width; cnt; --cnt) {
-			*(data_pt++) = lcd_bus_read_ram();						// Read byte slice from LCD panel
+	} else {
+		/* Clipped at the right border: one window per page to skip the invisible columns */
+		for (gfx_coord_t i = 0; i < pages; ++i) {
+			if (bitmap->type == GFX_MONO_BITMAP_PROGMEM) {
+				lcd_stream_window_P(x, page + i, x + width - 1, page + i, bitmap->data.progmem + i * bitmap->width);
+			} else {
+				lcd_stream_window(x, page + i, x + width - 1, page + i, bitmap->data.pixmap + i * bitmap->width);
+			}
+		}
+	}
+}
+
+/**
+ * \brief Put a bitmap not aligned to a page boundary to the LCD controller memory
+ *
+ * Each destination page holds the lower part of one source page and the
+ * upper part of the source page above, shifted by the pixel offset of y.
+ *
+ * \param bitmap Pointer to the bitmap
+ * \param x      X coordinate of the upper left corner
+ * \param y      Y coordinate of the upper left corner, not on a page boundary
+ */
+static void gfx_mono_lcd_uc1608_put_bitmap_shifted(struct gfx_mono_bitmap *bitmap, gfx_coord_t x, gfx_coord_t y)
+{
+	uint8_t			buf[LCD_BUS_BURST_CHUNK];
+	const uint8_t	shift		= y % GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	page		= y / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	pages		= bitmap->height / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	src_type	= (bitmap->type == GFX_MONO_BITMAP_PROGMEM) ?  GFX_MONO_LCD_UC1608_CACHE_SRC_PROGMEM : GFX_MONO_LCD_UC1608_CACHE_SRC_RAM;
+	const uint8_t	*src		= (bitmap->type == GFX_MONO_BITMAP_PROGMEM) ?  (const uint8_t *) bitmap->data.progmem : bitmap->data.pixmap;
+	uint8_t			width		= bitmap->width;
+
+	if (width > GFX_MONO_LCD_WIDTH - x) {
+		width = GFX_MONO_LCD_WIDTH - x;
+	}
+
+	/* One destination page more than source pages - the last one takes the remainder of the bottom source page */
+	for (uint8_t dst = 0; (dst <= pages) && ((page + dst) < GFX_MONO_LCD_PAGES); ++dst) {
+		for (uint8_t col = 0; col < width; ) {
+			const uint8_t cnt = ((width - col) > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : (width - col);
+
+			for (uint8_t i = 0; i < cnt; ++i) {
+				uint8_t data = 0;
+
+				if (dst < pages) {
+					data  = gfx_mono_lcd_uc1608_cache_src_byte(src, (uint16_t)dst * bitmap->width + col + i, src_type) << shift;
+				}
+				if (dst) {
+					data |= gfx_mono_lcd_uc1608_cache_src_byte(src, (uint16_t)(dst - 1) * bitmap->width + col + i, src_type) >> (GFX_MONO_LCD_PIXELS_PER_BYTE - shift);
+				}
+				buf[i] = data;
+			}
+
+			if (dst && (dst < pages)) {
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+				gfx_mono_lcd_uc1608_put_page(buf, page + dst, x + col, cnt);
+#else
+				lcd_page_set(page + dst);
+				lcd_col_set(x + col);
+				lcd_bus_write_ram_burst(buf, cnt);
+#endif
+
+			} else {
+				/* Top page: pixels above the bitmap stay - bottom page: pixels below the bitmap stay */
+				const uint8_t keep_mask = dst ?  (0xff << shift) : (0xff >> (GFX_MONO_LCD_PIXELS_PER_BYTE - shift));
+
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+				/* Merged into the framebuffer - written to the display device with the next frame */
+				for (uint8_t i = 0; i < cnt; ++i) {
+					const uint8_t old = gfx_mono_lcd_uc1608_get_byte(page + dst, x + col + i);
+					gfx_mono_lcd_uc1608_put_byte(page + dst, x + col + i, (old & keep_mask) | (buf[i] & ~keep_mask));
+				}
+#else
+				lcd_merge_span(page + dst, x + col, buf, keep_mask, cnt);
+#endif
+			}
+
+			col += cnt;
 		}
 	}
 }
 
+/**
+ * \brief Convert a glyph of a PROGMEM font to page columns
+ *
+ * \param ch   Character to be converted
+ * \param font Font to be used, not larger than 8 x 8 pixels
+ * \param cols Destination for \a font->width column bytes (LSB = top pixel)
+ * \return     Count of columns, 0 when the font is not supported.
+ */
+uint8_t gfx_mono_lcd_uc1608_glyph_columns(const char ch, const struct font *font, uint8_t *cols)
+{
+	const uint8_t width		= font->width;
+	const uint8_t height	= font->height;
+
+	if ((font->type != FONT_LOC_PROGMEM) ||
+		!width	|| (width	> GFX_MONO_LCD_PIXELS_PER_BYTE) ||
+		!height	|| (height	> GFX_MONO_LCD_PIXELS_PER_BYTE)) {
+		return 0;
+	}
+
+	for (uint8_t i = 0; i < width; ++i) {
+		cols[i] = 0;
+	}
+
+	/* Glyph rows (MSB = left pixel) to page columns (LSB = top pixel) */
+	uint8_t PROGMEM_PTR_T glyph_data = font->data.progmem + (uint16_t)height * ((uint8_t)ch - font->first_char);
+	for (uint8_t row = 0; row < height; ++row) {
+		uint8_t glyph_byte = PROGMEM_READ_BYTE(glyph_data++);
+
+		for (uint8_t i = 0; glyph_byte; ++i, glyph_byte <<= 1) {
+			if (glyph_byte & 0x80) {
+				cols[i] |= 1 << row;
+			}
+		}
+	}
+	return width;
+}
+
+/**
+ * \brief Draw a character cell of a PROGMEM font with one read and one write window
+ *
+ * The cell of \a font->width x \a font->height pixels is cleared and the glyph
+ * is merged in - the same result as the generic filled rectangle plus pixel
+ * path, but with one burst read and one window write per touched page.
+ *
+ * \param ch   Character to be drawn
+ * \param x    X coordinate of the upper left corner of the cell
+ * \param y    Y coordinate of the upper left corner of the cell
+ * \param font Font to be used
+ * \return     True when drawn, false when the font or position is not supported.
+ */
+bool gfx_mono_lcd_uc1608_draw_char_progmem(const char ch, gfx_coord_t x, gfx_coord_t y, const struct font *font)
+{
+	uint8_t buf[2 * GFX_MONO_LCD_PIXELS_PER_BYTE];
+	uint8_t colbits[GFX_MONO_LCD_PIXELS_PER_BYTE];
+	const uint8_t width		= font->width;
+	const uint8_t height	= font->height;
+
+	if ((((uint16_t)x + width)  > GFX_MONO_LCD_WIDTH) ||
+		(((uint16_t)y + height) > GFX_MONO_LCD_HEIGHT) ||
+		!gfx_mono_lcd_uc1608_glyph_columns(ch, font, colbits)) {
+		return false;
+	}
+
+	const uint8_t	page0	= y / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	page1	= (y + height - 1) / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	shift	= y % GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint16_t	mask	= ((1U << height) - 1) << shift;
+
+	gfx_mono_lcd_uc1608_get_page(buf, page0, x, width);
+	if (page1 != page0) {
+		gfx_mono_lcd_uc1608_get_page(buf + width, page1, x, width);
+	}
+
+	for (uint8_t i = 0; i < width; ++i) {
+		const uint16_t bits = (uint16_t)colbits[i] << shift;
+
+		buf[i] = (buf[i] & ~(uint8_t)mask) | (uint8_t)bits;
+		if (page1 != page0) {
+			buf[width + i] = (buf[width + i] & ~(uint8_t)(mask >> 8)) | (uint8_t)(bits >> 8);
+		}
+	}
+
+	lcd_stream_window(x, page0, x + width - 1, page1, buf);
+	return true;
+}
+
 /**
  * \brief Draw pixel to LCD controller memory
  *
@@ -139,6 +403,393 @@ void gfx_mono_lcd_uc1608_draw_pixel(gfx_coord_t x, gfx_coord_t y, gfx_mono_color
 	}
 }
 
+/**
+ * \brief Draw a horizontal line to LCD controller memory
+ *
+ * The line is drawn left to right as one span of the page: one address
+ * setup, one burst read and one burst write per chunk instead of a scalar
+ * read/modify/write for each column. Parts outside of the display area
+ * are clipped.
+ *
+ * \param x         X coordinate of the leftmost pixel
+ * \param y         Y coordinate of the line
+ * \param length    Length of the line in pixels
+ * \param color     Pixel operation
+ */
+void gfx_mono_lcd_uc1608_draw_horizontal_line(gfx_coord_t x, gfx_coord_t y, gfx_coord_t length, gfx_mono_color_t color)
+{
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	/* Drawn into the framebuffer - written to the display device with the next frame */
+	gfx_mono_generic_draw_horizontal_line(x, y, length, color);
+#else
+	if ((x < GFX_MONO_LCD_WIDTH) && (y < GFX_MONO_LCD_HEIGHT) && length) {
+		if (length > (GFX_MONO_LCD_WIDTH - x)) {
+			length = GFX_MONO_LCD_WIDTH - x;
+		}
+
+		lcd_rmw_span_const(y / GFX_MONO_LCD_PIXELS_PER_BYTE, x, 1 << (y % GFX_MONO_LCD_PIXELS_PER_BYTE), length, color);
+	}
+#endif
+}
+
+/**
+ * \brief Draw a filled rectangle to LCD controller memory
+ *
+ * Each page is touched once: the partially covered top and bottom pages
+ * with one read/modify/write span each, the fully covered pages with plain
+ * burst writes without any read. Pages of the full display width in a row
+ * are filled with a single run due to the address wrap-around. Parts
+ * outside of the display area are clipped.
+ *
+ * \param x         X coordinate of the left side
+ * \param y         Y coordinate of the top side
+ * \param width     Width of the rectangle
+ * \param height    Height of the rectangle
+ * \param color     Pixel operation
+ */
+void gfx_mono_lcd_uc1608_draw_filled_rect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t width, gfx_coord_t height, gfx_mono_color_t color)
+{
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	/* Drawn into the framebuffer - written to the display device with the next frame */
+	gfx_mono_generic_draw_filled_rect(x, y, width, height, color);
+#else
+	if ((x >= GFX_MONO_LCD_WIDTH) || (y >= GFX_MONO_LCD_HEIGHT) || !width || !height) {
+		return;
+	}
+
+	if (width > (GFX_MONO_LCD_WIDTH - x)) {
+		width = GFX_MONO_LCD_WIDTH - x;
+	}
+	if (height > (GFX_MONO_LCD_HEIGHT - y)) {
+		height = GFX_MONO_LCD_HEIGHT - y;
+	}
+
+	const uint8_t	y_last		= y + height - 1;
+	const uint8_t	page_first	= y      / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t	page_last	= y_last / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	uint8_t			mask_first	= 0xff << (y % GFX_MONO_LCD_PIXELS_PER_BYTE);
+	uint8_t			mask_last	= 0xff >> ((GFX_MONO_LCD_PIXELS_PER_BYTE - 1) - (y_last % GFX_MONO_LCD_PIXELS_PER_BYTE));
+	uint8_t			full_first	= page_first;
+	uint8_t			full_last	= page_last;
+
+	if (page_first == page_last) {
+		mask_first &= mask_last;
+		mask_last   = 0xff;
+	}
+
+	/* Partially covered pages */
+	if (mask_first != 0xff) {
+		lcd_rmw_span_const(page_first, x, mask_first, width, color);
+		++full_first;
+	}
+	if (mask_last != 0xff) {
+		lcd_rmw_span_const(page_last, x, mask_last, width, color);
+		--full_last;
+	}
+	if (full_first > full_last) {
+		return;
+	}
+
+	/* Fully covered pages */
+	if (color == GFX_PIXEL_XOR) {
+		for (uint8_t page = full_first; page <= full_last; ++page) {
+			lcd_rmw_span_const(page, x, 0xff, width, color);		// Inverting needs the current content
+		}
+
+	} else if (width == GFX_MONO_LCD_WIDTH) {
+		lcd_page_set(full_first);
+		lcd_col_set(0);
+		lcd_bus_fill_ram((color == GFX_PIXEL_SET) ?  0xff : 0x00, (uint16_t)(full_last - full_first + 1) * GFX_MONO_LCD_WIDTH);
+
+	} else {
+		for (uint8_t page = full_first; page <= full_last; ++page) {
+			lcd_page_set(page);
+			lcd_col_set(x);
+			lcd_bus_fill_ram((color == GFX_PIXEL_SET) ?  0xff : 0x00, width);
+		}
+	}
+#endif
+}
+
+/**
+ * \brief Draw a line to LCD controller memory
+ *
+ * Same pixels as the generic Bresenham implementation, but the pixel masks
+ * are collected per byte and emitted as runs of consecutive columns of a
+ * page: one read/modify/write span per run instead of one per pixel.
+ * Purely horizontal and vertical lines take the span and page mask paths.
+ *
+ * \param x1        X coordinate of the start point
+ * \param y1        Y coordinate of the start point
+ * \param x2        X coordinate of the end point
+ * \param y2        Y coordinate of the end point
+ * \param color     Pixel operation
+ */
+void gfx_mono_lcd_uc1608_draw_line(gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, gfx_mono_color_t color)
+{
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	/* Drawn into the framebuffer - written to the display device with the next frame */
+	gfx_mono_generic_draw_line(x1, y1, x2, y2, color);
+#else
+	gfx_mono_lcd_uc1608_run_t run;
+	gfx_coord_t tmp;
+
+	/* Left to right - the runs grow with the column address */
+	if (x1 > x2) {
+		tmp = x1;  x1 = x2;  x2 = tmp;
+		tmp = y1;  y1 = y2;  y2 = tmp;
+	}
+
+	if (y1 == y2) {
+		if (x1 < GFX_MONO_LCD_WIDTH) {
+			if (x2 >= GFX_MONO_LCD_WIDTH) {
+				x2 = GFX_MONO_LCD_WIDTH - 1;
+			}
+			gfx_mono_lcd_uc1608_draw_horizontal_line(x1, y1, x2 - x1 + 1, color);
+		}
+		return;
+	}
+
+	if (x1 == x2) {
+		if (y1 > y2) {
+			tmp = y1;  y1 = y2;  y2 = tmp;
+		}
+		if (y1 < GFX_MONO_LCD_HEIGHT) {
+			if (y2 >= GFX_MONO_LCD_HEIGHT) {
+				y2 = GFX_MONO_LCD_HEIGHT - 1;
+			}
+			gfx_mono_generic_draw_vertical_line(x1, y1, y2 - y1 + 1, color);
+		}
+		return;
+	}
+
+	const int16_t	dx		= x2 - x1;
+	int16_t			dy		= y2 - y1;
+	int8_t			yinc	= 1;
+	int16_t			e;
+
+	if (dy < 0) {
+		yinc	= -1;
+		dy		= -dy;
+	}
+
+	run.len = 0;
+	if (dx > dy) {
+		e = dy - dx;
+		for (int16_t i = 0; i <= dx; ++i) {
+			gfx_mono_lcd_uc1608_run_add(&run, x1, y1, color);
+			if (e >= 0) {
+				e  -= dx;
+				y1 += yinc;
+			}
+			e += dy;
+			++x1;
+		}
+
+	} else {
+		e = dx - dy;
+		for (int16_t i = 0; i <= dy; ++i) {
+			gfx_mono_lcd_uc1608_run_add(&run, x1, y1, color);
+			if (e >= 0) {
+				e  -= dy;
+				++x1;
+			}
+			e  += dx;
+			y1 += yinc;
+		}
+	}
+	gfx_mono_lcd_uc1608_run_flush(&run, color);
+#endif
+}
+
+/**
+ * \brief Draw a filled circle to LCD controller memory
+ *
+ * Same pixels as the union of the vertical lines of the generic
+ * implementation, but each pixel is touched exactly once: the circle is
+ * rasterized per page row, the extents of the eight pixel rows of a page
+ * give the pixel mask of each column. The partially covered columns of a
+ * page row are written with read/modify/write spans, the fully covered
+ * columns with a plain burst write without any read. Parts outside of the
+ * display area are clipped.
+ *
+ * \param x             X coordinate of center
+ * \param y             Y coordinate of center
+ * \param radius        Circle radius
+ * \param color         Pixel operation
+ * \param quadrant_mask Bitmask indicating which quadrants to draw
+ */
+void gfx_mono_lcd_uc1608_draw_filled_circle(gfx_coord_t x, gfx_coord_t y, gfx_coord_t radius, gfx_mono_color_t color, uint8_t quadrant_mask)
+{
+	uint8_t	extents[GFX_MONO_LCD_PIXELS_PER_BYTE];
+	int16_t	row_left[GFX_MONO_LCD_PIXELS_PER_BYTE];
+	int16_t	row_right[GFX_MONO_LCD_PIXELS_PER_BYTE];
+
+	if (!radius) {
+		gfx_mono_lcd_uc1608_draw_pixel(x, y, color);
+		return;
+	}
+
+	int16_t row_first	= (int16_t)y - radius;
+	int16_t row_last	= (int16_t)y + radius;
+
+	if (row_first < 0) {
+		row_first = 0;
+	}
+	if (row_last >= GFX_MONO_LCD_HEIGHT) {
+		row_last = GFX_MONO_LCD_HEIGHT - 1;
+	}
+
+	for (int16_t page = row_first / GFX_MONO_LCD_PIXELS_PER_BYTE; page <= row_last / GFX_MONO_LCD_PIXELS_PER_BYTE; ++page) {
+		const int16_t	row_top		= page * GFX_MONO_LCD_PIXELS_PER_BYTE;
+		int16_t			col_first	= GFX_MONO_LCD_WIDTH;
+		int16_t			col_last	= -1;
+		int16_t			full_first	= 0;
+		int16_t			full_last	= GFX_MONO_LCD_WIDTH - 1;
+		uint8_t			dist_min	= 0;
+
+		/* Smallest vertical distance of the page rows to the center */
+		if (y < row_top) {
+			dist_min = row_top - y;
+		} else if (y >= row_top + GFX_MONO_LCD_PIXELS_PER_BYTE) {
+			dist_min = y - (row_top + GFX_MONO_LCD_PIXELS_PER_BYTE - 1);
+		}
+		gfx_mono_lcd_uc1608_circle_extents(radius, dist_min, extents);
+
+		/* Horizontal extent of each pixel row */
+		for (uint8_t bit = 0; bit < GFX_MONO_LCD_PIXELS_PER_BYTE; ++bit) {
+			const int16_t	dy		= row_top + bit - y;
+			const uint16_t	dist	= (dy < 0) ?  -dy : dy;
+			const bool		left	= ((dy <= 0) && (quadrant_mask & GFX_QUADRANT1)) || ((dy >= 0) && (quadrant_mask & GFX_QUADRANT2));
+			const bool		right	= ((dy <= 0) && (quadrant_mask & GFX_QUADRANT0)) || ((dy >= 0) && (quadrant_mask & GFX_QUADRANT3));
+
+			row_left[bit]	= GFX_MONO_LCD_WIDTH;						// Empty row
+			row_right[bit]	= -1;
+			if ((dist <= radius) && (left || right)) {
+				const uint8_t extent = extents[dist - dist_min];
+
+				row_left[bit]	= left   ?  ((int16_t)x - extent) : x;
+				row_right[bit]	= right  ?  ((int16_t)x + extent) : x;
+				if (row_left[bit] < 0) {
+					row_left[bit] = 0;
+				}
+				if (row_right[bit] >= GFX_MONO_LCD_WIDTH) {
+					row_right[bit] = GFX_MONO_LCD_WIDTH - 1;
+				}
+				if (row_left[bit] > row_right[bit]) {
+					row_left[bit]	= GFX_MONO_LCD_WIDTH;
+					row_right[bit]	= -1;
+				}
+			}
+
+			if (col_first > row_left[bit]) {
+				col_first = row_left[bit];
+			}
+			if (col_last < row_right[bit]) {
+				col_last = row_right[bit];
+			}
+			if (full_first < row_left[bit]) {
+				full_first = row_left[bit];
+			}
+			if (full_last > row_right[bit]) {
+				full_last = row_right[bit];
+			}
+		}
+		if (col_first > col_last) {
+			continue;
+		}
+
+		if ((color == GFX_PIXEL_XOR) || (full_first > full_last)) {
+			/* Inverting needs the current content */
+			gfx_mono_lcd_uc1608_circle_masks(page, col_first, col_last, row_left, row_right, color);
+			continue;
+		}
+
+		gfx_mono_lcd_uc1608_circle_masks(page, col_first, full_first - 1, row_left, row_right, color);
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+		for (int16_t col = full_first; col <= full_last; ++col) {
+			gfx_mono_lcd_uc1608_put_byte(page, col, (color == GFX_PIXEL_SET) ?  0xff : 0x00);
+		}
+#else
+		lcd_page_set(page);
+		lcd_col_set(full_first);
+		lcd_bus_fill_ram((color == GFX_PIXEL_SET) ?  0xff : 0x00, full_last - full_first + 1);
+#endif
+		gfx_mono_lcd_uc1608_circle_masks(page, full_last + 1, col_last, row_left, row_right, color);
+	}
+}
+
+/**
+ * \brief Draw a circle outline to LCD controller memory
+ *
+ * Same pixels as the generic implementation, but the octant points are
+ * collected as pixel masks per byte in a scratch table, sorted by page and
+ * column. When the table is full and at the end, it is written as runs of
+ * consecutive columns: one read/modify/write span per run instead of one
+ * per pixel. Points hitting the same pixel twice cancel out with XOR, as
+ * with the generic implementation.
+ *
+ * \param x           X coordinate of center
+ * \param y           Y coordinate of center
+ * \param radius      Circle radius
+ * \param color       Pixel operation
+ * \param octant_mask Bitmask indicating which octants to draw
+ */
+void gfx_mono_lcd_uc1608_draw_circle(gfx_coord_t x, gfx_coord_t y, gfx_coord_t radius, gfx_mono_color_t color, uint8_t octant_mask)
+{
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	/* Drawn into the framebuffer - written to the display device with the next frame */
+	gfx_mono_generic_draw_circle(x, y, radius, color, octant_mask);
+#else
+	gfx_mono_lcd_uc1608_points_t points;
+	int16_t offset_x	= 0;
+	int16_t offset_y	= radius;
+	int16_t error		= 3 - 2 * radius;
+
+	if (!radius) {
+		gfx_mono_lcd_uc1608_draw_pixel(x, y, color);
+		return;
+	}
+
+	points.len = 0;
+	while (offset_x <= offset_y) {
+		if (octant_mask & GFX_OCTANT0) {
+			gfx_mono_lcd_uc1608_points_add(&points, x + offset_y, y - offset_x, color);
+		}
+		if (octant_mask & GFX_OCTANT1) {
+			gfx_mono_lcd_uc1608_points_add(&points, x + offset_x, y - offset_y, color);
+		}
+		if (octant_mask & GFX_OCTANT2) {
+			gfx_mono_lcd_uc1608_points_add(&points, x - offset_x, y - offset_y, color);
+		}
+		if (octant_mask & GFX_OCTANT3) {
+			gfx_mono_lcd_uc1608_points_add(&points, x - offset_y, y - offset_x, color);
+		}
+		if (octant_mask & GFX_OCTANT4) {
+			gfx_mono_lcd_uc1608_points_add(&points, x - offset_y, y + offset_x, color);
+		}
+		if (octant_mask & GFX_OCTANT5) {
+			gfx_mono_lcd_uc1608_points_add(&points, x - offset_x, y + offset_y, color);
+		}
+		if (octant_mask & GFX_OCTANT6) {
+			gfx_mono_lcd_uc1608_points_add(&points, x + offset_x, y + offset_y, color);
+		}
+		if (octant_mask & GFX_OCTANT7) {
+			gfx_mono_lcd_uc1608_points_add(&points, x + offset_y, y + offset_x, color);
+		}
+
+		if (error < 0) {
+			error += ((offset_x << 2) + 6);
+		} else {
+			error += (((offset_x - offset_y) << 2) + 10);
+			--offset_y;
+		}
+		++offset_x;
+	}
+	gfx_mono_lcd_uc1608_points_flush(&points, color);
+#endif
+}
+
 /**
  * \brief Get the pixel value at x,y in the LCD controller memory
  *
@@ -163,6 +814,10 @@ uint8_t gfx_mono_lcd_uc1608_get_pixel(gfx_coord_t x, gfx_coord_t y)
 /**
  * \brief Put a byte to the LCD controller memory
  *
+ * The byte is held in the cache and written to the display device by
+ * \ref gfx_mono_lcd_uc1608_cache_flush or when its cache entry is evicted.
+ * Later mask operations on the same byte are merged in the cache.
+ *
  * \param page   Page address
  * \param column Page offset (x coordinate)
  * \param data   Data to be written.
@@ -170,13 +825,17 @@ uint8_t gfx_mono_lcd_uc1608_get_pixel(gfx_coord_t x, gfx_coord_t y)
 void gfx_mono_lcd_uc1608_put_byte(gfx_coord_t page, gfx_coord_t column, uint8_t data)
 {
 	if ((page < GFX_MONO_LCD_PAGES) && (column < GFX_MONO_LCD_WIDTH)) {
-		/* Write back modified (dirty) data to the cache */
-		gfx_mono_lcd_uc1608_cache_write_byte(page, column, data);
-
-		/* Write current data back to the display device */
-		lcd_page_set(page);
-		lcd_col_set(column);
-		lcd_bus_write_ram(data);									// Write byte slice to RAM
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+		/* Write modified data to the framebuffer - written to the display device with the next frame */
+		gfx_mono_lcd_uc1608_shadow_load();
+		if (gfx_mono_framebuffer_get_byte(GFX_MONO_LCD_UC1608_SHADOW_PAGE(page), column) != data) {
+			gfx_mono_framebuffer_put_byte(GFX_MONO_LCD_UC1608_SHADOW_PAGE(page), column, data);
+			gfx_mono_lcd_uc1608_fb_dirty_mark(page, column, 1);
+		}
+#else
+		/* Write modified (dirty) data to the cache - written back to the display device later */
+		gfx_mono_lcd_uc1608_cache_write_byte(page, column, data, true);
+#endif
 	}
 }
 
@@ -194,16 +853,52 @@ uint8_t gfx_mono_lcd_uc1608_get_byte(gfx_coord_t page, gfx_coord_t column)
 	if ((page < GFX_MONO_LCD_PAGES) && (column < GFX_MONO_LCD_WIDTH)) {
 		/* Request data from the cache */
 		if (gfx_mono_lcd_uc1608_cache_read_byte(page, column, &data)) {
+			LCD_STATS_ADD(LCD_STATS_CACHE_HIT, 1);
 			return data;
 		}
 
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+		if (GFX_MONO_LCD_UC1608_SHADOWED(page)) {
+			LCD_STATS_ADD(LCD_STATS_CACHE_HIT, 1);
+			gfx_mono_lcd_uc1608_shadow_load();
+			return gfx_mono_framebuffer_get_byte(GFX_MONO_LCD_UC1608_SHADOW_PAGE(page), column);
+		}
+#endif
+		LCD_STATS_ADD(LCD_STATS_CACHE_MISS, 1);
+
+#if (GFX_MONO_LCD_UC1608_CACHE_LINE > 1)
+		/* Cache miss: read the line of columns around from the display unit - drawing continues next to it */
+		uint8_t line[GFX_MONO_LCD_UC1608_CACHE_LINE];
+		const uint8_t first = column & ~(GFX_MONO_LCD_UC1608_CACHE_LINE - 1);
+		uint8_t len = GFX_MONO_LCD_UC1608_CACHE_LINE;
+
+		if (len > (GFX_MONO_LCD_WIDTH - first)) {
+			len = GFX_MONO_LCD_WIDTH - first;
+		}
+		lcd_page_set(page);
+		lcd_col_set(first);
+		lcd_bus_read_ram_burst(line, len);							// Read byte slices from RAM, one dummy read only
+
+		for (uint8_t i = 0; i < len; ++i) {
+			const uint8_t col = first + i;
+
+			if (col == column) {
+				gfx_mono_lcd_uc1608_cache_write_byte(page, col, line[i], false);
+
+			} else if (!(g_gfx_mono_lcd_uc1608_cache.adr[gfx_mono_lcd_uc1608_cache_calc_idx(page, col)] & GFX_MONO_LCD_UC1608_CACHE_DIRTY)) {
+				gfx_mono_lcd_uc1608_cache_write_byte(page, col, line[i], false);	// Prefetched - pending pixels are not evicted for it
+			}
+		}
+		data = line[column - first];
+#else
 		/* Cache miss: read current data from the display unit */
 		lcd_page_set(page);
 		lcd_col_set(column);
 		data = lcd_bus_read_ram();									// Read byte slice from RAM
 
 		/* Store current data to the cache */
-		gfx_mono_lcd_uc1608_cache_write_byte(page, column, data);
+		gfx_mono_lcd_uc1608_cache_write_byte(page, column, data, false);
+#endif
 	}
 
 	return data;
@@ -246,6 +941,246 @@ void gfx_mono_lcd_uc1608_mask_byte(gfx_coord_t page, gfx_coord_t column, gfx_mon
 	}
 }
 
+/**
+ * \brief Read/Modify/Write a run of consecutive bytes in the LCD controller memory
+ *
+ * Same as \ref gfx_mono_lcd_uc1608_mask_byte for each byte of the run, but with
+ * one burst read and one burst write per chunk instead of a scalar access each.
+ * The run is clipped at the right border of the page. The cache takes over the
+ * written data.
+ *
+ * \param page        Page address
+ * \param column      Page offset (x coordinate) of the first byte
+ * \param pixel_masks Masks for the pixel operation, one per column
+ * \param width       Count of bytes
+ * \param color       Pixel operation
+ */
+void gfx_mono_lcd_uc1608_mask_span(gfx_coord_t page, gfx_coord_t column, const uint8_t *pixel_masks, uint8_t width, gfx_mono_color_t color)
+{
+	if (pixel_masks && width &&
+		(page < GFX_MONO_LCD_PAGES) && (column < GFX_MONO_LCD_WIDTH)) {
+		lcd_rmw_span(page, column, pixel_masks, width, color);
+	}
+}
+
+
+/**
+ * \brief Add a pixel to a run of pixel masks
+ *
+ * Pixels have to be added with non-decreasing x coordinates. The run is
+ * written when the pixel leaves its page or its columns, or when it is full.
+ * Pixels outside of the display area are dropped.
+ *
+ * \param run       Run of the pixel masks collected
+ * \param x         X coordinate of the pixel
+ * \param y         Y coordinate of the pixel
+ * \param color     Pixel operation
+ */
+static void gfx_mono_lcd_uc1608_run_add(gfx_mono_lcd_uc1608_run_t *run, gfx_coord_t x, gfx_coord_t y, gfx_mono_color_t color)
+{
+	if ((x >= GFX_MONO_LCD_WIDTH) || (y >= GFX_MONO_LCD_HEIGHT)) {
+		return;
+	}
+
+	const uint8_t page = y / GFX_MONO_LCD_PIXELS_PER_BYTE;
+	const uint8_t mask = 1 << (y % GFX_MONO_LCD_PIXELS_PER_BYTE);
+
+	if (run->len && (page == run->page)) {
+		const uint8_t next = run->column + run->len;
+
+		if (x == (next - 1)) {
+			run->masks[run->len - 1] |= mask;						// Same byte
+			return;
+		}
+		if ((x == next) && (run->len < sizeof(run->masks))) {
+			run->masks[run->len++] = mask;							// Next column
+			return;
+		}
+	}
+
+	gfx_mono_lcd_uc1608_run_flush(run, color);
+	run->page		= page;
+	run->column		= x;
+	run->masks[0]	= mask;
+	run->len		= 1;
+}
+
+/**
+ * \brief Write a run of pixel masks with one read/modify/write span
+ *
+ * \param run       Run of the pixel masks collected, empty afterwards
+ * \param color     Pixel operation
+ */
+static void gfx_mono_lcd_uc1608_run_flush(gfx_mono_lcd_uc1608_run_t *run, gfx_mono_color_t color)
+{
+	if (run->len) {
+		lcd_rmw_span(run->page, run->column, run->masks, run->len, color);
+		run->len = 0;
+	}
+}
+
+/**
+ * \brief Add a pixel to the scratch table of pixel masks
+ *
+ * The table is kept sorted by page and column. Pixels of a byte already
+ * in the table are merged into its mask - toggled with XOR, so that a pixel
+ * hit twice is left as it is. A full table is written first. Pixels outside
+ * of the display area are dropped.
+ *
+ * \param points    Scratch table of the pixel masks collected
+ * \param x         X coordinate of the pixel
+ * \param y         Y coordinate of the pixel
+ * \param color     Pixel operation
+ */
+static void gfx_mono_lcd_uc1608_points_add(gfx_mono_lcd_uc1608_points_t *points, gfx_coord_t x, gfx_coord_t y, gfx_mono_color_t color)
+{
+	if ((x >= GFX_MONO_LCD_WIDTH) || (y >= GFX_MONO_LCD_HEIGHT)) {
+		return;
+	}
+
+	const uint16_t	adr		= ((uint16_t)(y / GFX_MONO_LCD_PIXELS_PER_BYTE) << 8) | x;
+	const uint8_t	mask	= 1 << (y % GFX_MONO_LCD_PIXELS_PER_BYTE);
+	uint8_t			idx		= points->len;
+
+	/* Search from the end, the points of an iteration are close to each other */
+	while (idx && (points->adr[idx - 1] >= adr)) {
+		if (points->adr[--idx] == adr) {
+			if (color == GFX_PIXEL_XOR) {
+				points->masks[idx] ^= mask;
+			} else {
+				points->masks[idx] |= mask;
+			}
+			return;
+		}
+	}
+
+	if (points->len == GFX_MONO_LCD_UC1608_POINTS) {
+		gfx_mono_lcd_uc1608_points_flush(points, color);
+		idx = 0;
+	}
+
+	for (uint8_t pos = points->len; pos > idx; --pos) {
+		points->adr[pos]	= points->adr[pos - 1];
+		points->masks[pos]	= points->masks[pos - 1];
+	}
+	points->adr[idx]	= adr;
+	points->masks[idx]	= mask;
+	++points->len;
+}
+
+/**
+ * \brief Write the scratch table of pixel masks as runs of consecutive columns
+ *
+ * \param points    Scratch table of the pixel masks collected, empty afterwards
+ * \param color     Pixel operation
+ */
+static void gfx_mono_lcd_uc1608_points_flush(gfx_mono_lcd_uc1608_points_t *points, gfx_mono_color_t color)
+{
+	gfx_mono_lcd_uc1608_run_t run;
+
+	run.len = 0;
+	for (uint8_t idx = 0; idx < points->len; ++idx) {
+		const uint8_t page		= points->adr[idx] >> 8;
+		const uint8_t column	= points->adr[idx] & 0xff;
+
+		if (run.len && (page == run.page) && (column == (run.column + run.len)) && (run.len < sizeof(run.masks))) {
+			run.masks[run.len++] = points->masks[idx];
+			continue;
+		}
+
+		gfx_mono_lcd_uc1608_run_flush(&run, color);
+		run.page		= page;
+		run.column		= column;
+		run.masks[0]	= points->masks[idx];
+		run.len			= 1;
+	}
+	gfx_mono_lcd_uc1608_run_flush(&run, color);
+	points->len = 0;
+}
+
+/**
+ * \brief Get the horizontal extents of a filled circle for eight pixel rows
+ *
+ * Runs the midpoint circle algorithm of the generic implementation and picks
+ * the extents of the rows with the vertical distances \a dist_min up to
+ * \a dist_min + 7 to the center. The raster is symmetric, the extent of a
+ * row equals the height of the column at the same distance.
+ *
+ * \param radius    Circle radius
+ * \param dist_min  Vertical distance of the first row to the center
+ * \param extents   Horizontal distance of the last pixel of each row to the center
+ */
+static void gfx_mono_lcd_uc1608_circle_extents(gfx_coord_t radius, uint8_t dist_min, uint8_t *extents)
+{
+	int16_t offset_x	= 0;
+	int16_t offset_y	= radius;
+	int16_t error		= 3 - 2 * radius;
+
+	for (uint8_t idx = 0; idx < GFX_MONO_LCD_PIXELS_PER_BYTE; ++idx) {
+		extents[idx] = 0;
+	}
+
+	while (offset_x <= offset_y) {
+		const uint16_t idx_x = offset_x - dist_min;
+		const uint16_t idx_y = offset_y - dist_min;
+
+		if ((idx_x < GFX_MONO_LCD_PIXELS_PER_BYTE) && (extents[idx_x] < offset_y)) {
+			extents[idx_x] = offset_y;
+		}
+		if ((idx_y < GFX_MONO_LCD_PIXELS_PER_BYTE) && (extents[idx_y] < offset_x)) {
+			extents[idx_y] = offset_x;
+		}
+
+		if (error < 0) {
+			error += ((offset_x << 2) + 6);
+		} else {
+			error += (((offset_x - offset_y) << 2) + 10);
+			--offset_y;
+		}
+		++offset_x;
+	}
+}
+
+/**
+ * \brief Write the pixel masks of a column range of a filled circle page row
+ *
+ * The masks are collected in chunks and written with one read/modify/write
+ * span each.
+ *
+ * \param page       Page address
+ * \param col_first  First column to be written
+ * \param col_last   Last column to be written
+ * \param row_left   Left-most column of each pixel row of the page
+ * \param row_right  Right-most column of each pixel row of the page
+ * \param color      Pixel operation
+ */
+static void gfx_mono_lcd_uc1608_circle_masks(uint8_t page, int16_t col_first, int16_t col_last, const int16_t *row_left, const int16_t *row_right, gfx_mono_color_t color)
+{
+	uint8_t masks[LCD_BUS_BURST_CHUNK];
+	uint8_t len = 0;
+
+	for (int16_t col = col_first; col <= col_last; ++col) {
+		uint8_t mask = 0;
+
+		for (uint8_t bit = 0; bit < GFX_MONO_LCD_PIXELS_PER_BYTE; ++bit) {
+			if ((row_left[bit] <= col) && (col <= row_right[bit])) {
+				mask |= 1 << bit;
+			}
+		}
+		masks[len++] = mask;
+
+		if ((len == sizeof(masks)) || (col == col_last)) {
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+			for (uint8_t idx = 0; idx < len; ++idx) {
+				gfx_mono_lcd_uc1608_mask_byte(page, col - len + 1 + idx, masks[idx], color);
+			}
+#else
+			lcd_rmw_span(page, col - len + 1, masks, len, color);
+#endif
+			len = 0;
+		}
+	}
+}
 
 /**
  * \brief Search an index position of a cached address
@@ -265,35 +1200,331 @@ static uint16_t gfx_mono_lcd_uc1608_cache_calc_adr(uint8_t page, uint8_t column)
 	return 0x8000U;  // Non-valid position
 }
 
+/**
+ * \brief Calculate the cache entry a byte position is mapped to
+ *
+ * Neighboring columns and the pages above and below of a column are
+ * mapped to different entries.
+ *
+ * \param page       Page address
+ * \param column     Page offset (x coordinate)
+ * \return           Index into the cache arrays.
+ */
+static uint8_t gfx_mono_lcd_uc1608_cache_calc_idx(uint8_t page, uint8_t column)
+{
+	return (uint8_t) (column + (page << 3)) & GFX_MONO_LCD_UC1608_CACHE_MASK;
+}
+
+/**
+ * \brief Keep the cached data coherent with data written to the display device
+ *
+ * Called by the bus layer for each RAM write. Cached positions take over the
+ * new data and are clean afterwards, positions not cached are not allocated.
+ * The written run wraps around into the next page (C_LCD_AC).
+ *
+ * \param page       Page address of the first byte, out of range when unknown
+ * \param column     Page offset of the first byte, out of range when unknown
+ * \param src        Data written: RAM or PROGMEM address, or address of the fill value
+ * \param len        Count of bytes written
+ * \param type       Source type GFX_MONO_LCD_UC1608_CACHE_SRC_xxx
+ */
+void gfx_mono_lcd_uc1608_cache_written(uint8_t page, uint8_t column, const uint8_t *src, uint16_t len, uint8_t type)
+{
+	uint16_t *adr = g_gfx_mono_lcd_uc1608_cache.adr;
+
+	if ((page >= GFX_MONO_LCD_PAGES) || (column >= GFX_MONO_LCD_WIDTH)) {
+		/* Position unknown: drop the clean entries, pending pixels are kept */
+		for (uint16_t idx = 0; idx < GFX_MONO_LCD_UC1608_CACHE_SIZE; ++idx) {
+			if (!(adr[idx] & GFX_MONO_LCD_UC1608_CACHE_DIRTY)) {
+				adr[idx] = 0;
+			}
+		}
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+		gfx_mono_lcd_uc1608_shadow_valid = false;
+#endif
+		return;
+	}
+
+	if (len > GFX_MONO_LCD_FRAMEBUFFER_SIZE) {
+		len = GFX_MONO_LCD_FRAMEBUFFER_SIZE;
+	}
+	const uint16_t start = (uint16_t)page * GFX_MONO_LCD_WIDTH + column;
+
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+	gfx_mono_lcd_uc1608_shadow_written(start, src, len, type);
+#endif
+
+	for (uint16_t i = 0; i < GFX_MONO_LCD_UC1608_CACHE_SIZE; ++i) {
+		uint16_t idx = i;
+		uint16_t off = i;
+
+		if (len <= GFX_MONO_LCD_UC1608_CACHE_SIZE) {
+			/* Short run: look up each written position */
+			if (off >= len) {
+				break;
+			}
+			idx = gfx_mono_lcd_uc1608_cache_calc_idx(page, column);
+			if ((adr[idx] & ~GFX_MONO_LCD_UC1608_CACHE_DIRTY) != gfx_mono_lcd_uc1608_cache_calc_adr(page, column)) {
+				idx = GFX_MONO_LCD_UC1608_CACHE_SIZE;				// Not cached
+			}
+			if (++column >= GFX_MONO_LCD_WIDTH) {
+				column = 0;
+				page = (page + 1) % GFX_MONO_LCD_PAGES;
+			}
+
+		} else {
+			/* Long run: check each entry for being covered */
+			if (!adr[idx]) {
+				continue;
+			}
+			const uint16_t pos = ((adr[idx] >> 8) & 0x0f) * GFX_MONO_LCD_WIDTH + (adr[idx] & 0xff);
+			off = (pos >= start) ?  (pos - start) : (pos + GFX_MONO_LCD_FRAMEBUFFER_SIZE - start);
+			if (off >= len) {
+				continue;
+			}
+		}
+
+		if (idx < GFX_MONO_LCD_UC1608_CACHE_SIZE) {
+			g_gfx_mono_lcd_uc1608_cache.data[idx] = gfx_mono_lcd_uc1608_cache_src_byte(src, off, type);
+			adr[idx] &= ~GFX_MONO_LCD_UC1608_CACHE_DIRTY;
+		}
+	}
+}
+
+/**
+ * \brief Fetch a byte of data written to the display device
+ *
+ * \param src        Data written: RAM or PROGMEM address, or address of the fill value
+ * \param off        Offset of the byte within the run
+ * \param type       Source type GFX_MONO_LCD_UC1608_CACHE_SRC_xxx
+ * \return           Data byte.
+ */
+static uint8_t gfx_mono_lcd_uc1608_cache_src_byte(const uint8_t *src, uint16_t off, uint8_t type)
+{
+	switch (type) {
+		case GFX_MONO_LCD_UC1608_CACHE_SRC_RAM:
+			return src[off];
+
+		case GFX_MONO_LCD_UC1608_CACHE_SRC_PROGMEM:
+			return PROGMEM_READ_BYTE(src + off);
+
+		default:
+			return *src;
+	}
+}
+
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+/**
+ * \brief Load the shadow pages from the display device once
+ *
+ * The framebuffer module addresses the shadow pages from 0 on, see
+ * \ref GFX_MONO_LCD_UC1608_SHADOW_PAGE.
+ */
+static void gfx_mono_lcd_uc1608_shadow_load(void)
+{
+	if (gfx_mono_lcd_uc1608_shadow_valid) {
+		return;
+	}
+
+	gfx_mono_lcd_uc1608_cache_flush_entries();
+	gfx_mono_set_framebuffer(gfx_mono_lcd_uc1608_shadow);
+
+	for (uint8_t i = 0; i < GFX_MONO_LCD_UC1608_SHADOW_PAGES; ++i) {
+		lcd_page_set(GFX_MONO_LCD_UC1608_SHADOW_FIRST_PAGE + i);
+		lcd_col_set(0);
+		lcd_bus_read_ram_burst(gfx_mono_lcd_uc1608_shadow + i * GFX_MONO_LCD_WIDTH, GFX_MONO_LCD_WIDTH);
+	}
+	gfx_mono_lcd_uc1608_shadow_valid = true;
+}
+
+/**
+ * \brief Mirror data written to the display device into the shadow pages
+ *
+ * \param start      Linear position (page * width + column) of the first byte
+ * \param src        Data written: RAM or PROGMEM address, or address of the fill value
+ * \param len        Count of bytes written, wrapping around at the end of the display
+ * \param type       Source type GFX_MONO_LCD_UC1608_CACHE_SRC_xxx
+ */
+static void gfx_mono_lcd_uc1608_shadow_written(uint16_t start, const uint8_t *src, uint16_t len, uint8_t type)
+{
+	const uint16_t first	= GFX_MONO_LCD_UC1608_SHADOW_FIRST_PAGE * GFX_MONO_LCD_WIDTH;
+	const uint16_t last		= first + sizeof(gfx_mono_lcd_uc1608_shadow);
+
+	for (uint16_t off = 0, run; off < len; off += run, start = 0) {
+		run = GFX_MONO_LCD_FRAMEBUFFER_SIZE - start;				// Up to the wrap-around
+		if (run > (len - off)) {
+			run = len - off;
+		}
+
+		const uint16_t lo = (start > first) ?  start : first;
+		const uint16_t hi = ((start + run) < last) ?  (start + run) : last;
+		for (uint16_t pos = lo; pos < hi; ++pos) {
+			gfx_mono_lcd_uc1608_shadow[pos - first] = gfx_mono_lcd_uc1608_cache_src_byte(src, off + (pos - start), type);
+		}
+	}
+}
+#endif
+
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+/**
+ * \brief Add a run of columns of a page to the dirty rectangles of the framebuffer
+ *
+ * \param page       Page address
+ * \param column     Page offset of the first byte
+ * \param width      Count of bytes, not crossing the right border
+ */
+static void gfx_mono_lcd_uc1608_fb_dirty_mark(uint8_t page, uint8_t column, uint8_t width)
+{
+	const uint8_t last = column + width - 1;
+
+	if (!(gfx_mono_lcd_uc1608_fb_dirty_pages & (1U << page))) {
+		gfx_mono_lcd_uc1608_fb_dirty_pages |= 1U << page;
+		gfx_mono_lcd_uc1608_fb_dirty_min[page] = column;
+		gfx_mono_lcd_uc1608_fb_dirty_max[page] = last;
+		return;
+	}
+
+	if (gfx_mono_lcd_uc1608_fb_dirty_min[page] > column) {
+		gfx_mono_lcd_uc1608_fb_dirty_min[page] = column;
+	}
+	if (gfx_mono_lcd_uc1608_fb_dirty_max[page] < last) {
+		gfx_mono_lcd_uc1608_fb_dirty_max[page] = last;
+	}
+}
+
+/**
+ * \brief Write the dirty rectangles of the framebuffer to the display device
+ *
+ * Each dirty page is written with one window burst of its changed column
+ * range. Pages changed in full width in a row are contiguous in the
+ * framebuffer and written with a single window.
+ */
+static void gfx_mono_lcd_uc1608_fb_flush(void)
+{
+	const uint16_t dirty_pages = gfx_mono_lcd_uc1608_fb_dirty_pages;
+
+	gfx_mono_lcd_uc1608_fb_dirty_pages = 0;
+	for (uint8_t page = 0, cnt; page < GFX_MONO_LCD_PAGES; page += cnt) {
+		cnt = 1;
+		if (!(dirty_pages & (1U << page))) {
+			continue;
+		}
+
+		const uint8_t x0 = gfx_mono_lcd_uc1608_fb_dirty_min[page];
+		const uint8_t x1 = gfx_mono_lcd_uc1608_fb_dirty_max[page];
+
+		if (!x0 && (x1 == (GFX_MONO_LCD_WIDTH - 1))) {
+			while (((page + cnt) < GFX_MONO_LCD_PAGES) && (dirty_pages & (1U << (page + cnt))) &&
+				   !gfx_mono_lcd_uc1608_fb_dirty_min[page + cnt] &&
+				   (gfx_mono_lcd_uc1608_fb_dirty_max[page + cnt] == (GFX_MONO_LCD_WIDTH - 1))) {
+				++cnt;
+			}
+		}
+
+		lcd_stream_window(x0, page, x1, page + cnt - 1, gfx_mono_lcd_uc1608_shadow + (uint16_t)page * GFX_MONO_LCD_WIDTH + x0);
+	}
+}
+#endif
+
+/**
+ * \brief Write all dirty data back to the display device
+ *
+ * Dirty entries of the cache and, with the framebuffer variant, the dirty
+ * rectangles of the framebuffer are written.
+ */
+void gfx_mono_lcd_uc1608_cache_flush()
+{
+	gfx_mono_lcd_uc1608_cache_flush_entries();
+
+#if GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	gfx_mono_lcd_uc1608_fb_flush();
+#endif
+}
+
+/**
+ * \brief Write all dirty cache entries back to the display device
+ *
+ * Entries of adjacent columns of a page are written with one burst. The
+ * entries stay valid.
+ */
+static void gfx_mono_lcd_uc1608_cache_flush_entries(void)
+{
+	uint16_t *adr = g_gfx_mono_lcd_uc1608_cache.adr;
+
+	for (uint16_t idx = 0, len; idx < GFX_MONO_LCD_UC1608_CACHE_SIZE; idx += len) {
+		len = 1;
+		if (!(adr[idx] & GFX_MONO_LCD_UC1608_CACHE_DIRTY)) {
+			continue;
+		}
+
+		/* Run of dirty entries following in the same page */
+		while (((idx + len) < GFX_MONO_LCD_UC1608_CACHE_SIZE) && (adr[idx + len] == (adr[idx] + len))) {
+			++len;
+		}
+
+		lcd_page_set((adr[idx] >> 8) & 0x0f);
+		lcd_col_set(adr[idx] & 0xff);
+		lcd_bus_write_ram_burst(&(g_gfx_mono_lcd_uc1608_cache.data[idx]), len);
+
+		for (uint16_t i = idx; i < (idx + len); ++i) {
+			adr[i] &= ~GFX_MONO_LCD_UC1608_CACHE_DIRTY;
+		}
+	}
+}
+
 /**
  * \brief Clear all cached data
  *
+ * Dirty entries are written back to the display device before. The shadow
+ * pages are loaded again on the next access.
  */
-inline
 void gfx_mono_lcd_uc1608_cache_clear()
 {
-	g_gfx_mono_lcd_uc1608_cache.adr = 0;
+	gfx_mono_lcd_uc1608_cache_flush();
+
+#if GFX_MONO_LCD_UC1608_SHADOW_PAGES
+	gfx_mono_lcd_uc1608_shadow_valid = false;
+#endif
+
+	for (uint16_t idx = 0; idx < GFX_MONO_LCD_UC1608_CACHE_SIZE; ++idx) {
+		g_gfx_mono_lcd_uc1608_cache.adr[idx] = 0;
+	}
 }
 
 /**
  * \brief Store changed data to the cache
  *
- * This function stores the data to the cache. The importance is re-calculated for each
- * cache items.
+ * This function stores the data to the cache. A previous entry mapped to the
+ * same index is replaced - and written to the display device when dirty.
  *
  * \param page       Page address
  * \param column     Page offset (x coordinate)
  * \param data       Data to be stored in the cache
+ * \param dirty      Data differs from the display device
  */
-static void gfx_mono_lcd_uc1608_cache_write_byte(uint8_t page, uint8_t column, uint8_t data)
+static void gfx_mono_lcd_uc1608_cache_write_byte(uint8_t page, uint8_t column, uint8_t data, bool dirty)
 {
 	const uint16_t adr = gfx_mono_lcd_uc1608_cache_calc_adr(page, column);
 	if (!(adr & 0x4000U)) {
 		return;														// Non-valid position
 	}
 
-	g_gfx_mono_lcd_uc1608_cache.adr  = adr;
-	g_gfx_mono_lcd_uc1608_cache.data = data;
+	const uint8_t idx = gfx_mono_lcd_uc1608_cache_calc_idx(page, column);
+	const uint16_t old_adr = g_gfx_mono_lcd_uc1608_cache.adr[idx];
+
+	if (old_adr & GFX_MONO_LCD_UC1608_CACHE_DIRTY) {
+		if ((old_adr & ~GFX_MONO_LCD_UC1608_CACHE_DIRTY) == adr) {
+			dirty = true;											// Merge into the pending write
+		} else {
+			/* Evict: write back the dirty entry of another position */
+			lcd_page_set((old_adr >> 8) & 0x0f);
+			lcd_col_set(old_adr & 0xff);
+			lcd_bus_write_ram(g_gfx_mono_lcd_uc1608_cache.data[idx]);
+		}
+	}
+
+	g_gfx_mono_lcd_uc1608_cache.adr[idx]  = dirty ?  (adr | GFX_MONO_LCD_UC1608_CACHE_DIRTY) : adr;
+	g_gfx_mono_lcd_uc1608_cache.data[idx] = data;
 }
 
 /**
@@ -311,9 +1542,13 @@ static bool gfx_mono_lcd_uc1608_cache_read_byte(uint8_t page, uint8_t column, ui
 {
 	const uint16_t adr = gfx_mono_lcd_uc1608_cache_calc_adr(page, column);
 
-	if ((adr & 0x4000) && (g_gfx_mono_lcd_uc1608_cache.adr == adr) && data) {
-		*data = g_gfx_mono_lcd_uc1608_cache.data;
-		return true;
+	if ((adr & 0x4000) && data) {
+		const uint8_t idx = gfx_mono_lcd_uc1608_cache_calc_idx(page, column);
+
+		if ((g_gfx_mono_lcd_uc1608_cache.adr[idx] & ~GFX_MONO_LCD_UC1608_CACHE_DIRTY) == adr) {
+			*data = g_gfx_mono_lcd_uc1608_cache.data[idx];
+			return true;
+		}
 	}
 	return false;  // No cache data stored into target
 }
@@ -0,0 +1,85 @@
+/**
+ * \file
+ *
+ * \brief Monochrome graphic library for the UC1608 LCD controller - framebuffer variant
+ *
+ * Copyright (c) 2011-2017 Atmel Corporation. All rights reserved.
+ *
+ * \asf_license_start
+ *
+ * \page License
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of Atmel may not be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * 4. This software may only be redistributed and used in connection with an
+ *    Atmel microcontroller product.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ATMEL "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT ARE
+ * EXPRESSLY AND SPECIFICALLY DISCLAIMED. IN NO EVENT SHALL ATMEL BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \asf_license_stop
+ *
+ */
+/*
+ * Support and FAQ: visit <a href="http://www.atmel.com/design-support/">Atmel Support</a>
+ */
+
+#ifndef GFX_MONO_LCD_UC1608_FB_H
+#define GFX_MONO_LCD_UC1608_FB_H
+
+/**
+ * \ingroup gfx_mono_lcd_uc1608
+ * \defgroup gfx_mono_lcd_uc1608_fb UC1608 LCD display device with framebuffer
+ *
+ * Selected by GFX_MONO_LCD_UC1608_FB instead of GFX_MONO_LCD_UC1608. All
+ * pages of the display are mirrored in SRAM and drawing works on the
+ * framebuffer only. The changed column range of each page is tracked and
+ * written to the display device by gfx_mono_put_framebuffer() with one
+ * window burst per dirty rectangle - pages changed in full width in a row
+ * are one window. The output is the same as with the write-through driver.
+ *
+ * @{
+ */
+
+#ifndef GFX_MONO_LCD_UC1608
+#define GFX_MONO_LCD_UC1608
+#endif
+
+#define GFX_MONO_LCD_UC1608_FRAMEBUFFER								1
+
+/* The framebuffer is made of the shadow pages of the UC1608 driver covering the whole display */
+#undef  GFX_MONO_LCD_UC1608_SHADOW_PAGES
+#define GFX_MONO_LCD_UC1608_SHADOW_PAGES							16
+#undef  GFX_MONO_LCD_UC1608_SHADOW_FIRST_PAGE
+#define GFX_MONO_LCD_UC1608_SHADOW_FIRST_PAGE						0
+
+#include "gfx_mono_lcd_uc1608.h"
+
+/* 3840 bytes of framebuffer do not fit into the SRAM of the ATmega328P - keep 1 kB for the application */
+#if defined(__AVR__) && ((RAMEND - RAMSTART + 1) < (GFX_MONO_LCD_FRAMEBUFFER_SIZE + 1024))
+#error GFX_MONO_LCD_UC1608_FB: SRAM of the device is too small for the framebuffer, select GFX_MONO_LCD_UC1608 instead
+#endif
+
+/** @} */
+
+#endif /* GFX_MONO_LCD_UC1608_FB_H */
@@ -227,6 +227,13 @@ static void gfx_mono_draw_char_progmem(const char ch, const gfx_coord_t x,
 void gfx_mono_draw_char(const char c, const gfx_coord_t x, const gfx_coord_t y,
 		const struct font *font)
 {
+#if defined(GFX_MONO_LCD_UC1608) && !GFX_MONO_LCD_UC1608_FRAMEBUFFER
+	/* The driver blits the whole character cell when the font fits */
+	if (gfx_mono_lcd_uc1608_draw_char_progmem(c, x, y, font)) {
+		return;
+	}
+#endif
+
 	gfx_mono_draw_filled_rect(x, y, font->width, font->height,
 			GFX_PIXEL_CLR);
 
@@ -183,12 +183,12 @@ ISR(__vector_9, ISR_BLOCK)
 			if (sw_i) {												// SW-I: decrement contrast voltage
 				if (g_lcd_contrast_pm) {
 					--g_lcd_contrast_pm;
-					lcd_contrast_update();
+					lcd_defer(LCD_DEFER_OP_CONTRAST, 0);
 				}
 			} else if (sw_q) {										// SW-Q: increment contrast voltage
 				if (g_lcd_contrast_pm < 0x3f) {
 					++g_lcd_contrast_pm;
-					lcd_contrast_update();
+					lcd_defer(LCD_DEFER_OP_CONTRAST, 0);
 				}
 			}
 
@@ -198,6 +198,9 @@ ISR(__vector_9, ISR_BLOCK)
 		}
 	}
 
+	/* Display effects blinker */
+	lcd_effect_blink_tick();
+
 	/* Beep length enables audio output */
 	if (g_audio_out_length) {
 		--g_audio_out_length;
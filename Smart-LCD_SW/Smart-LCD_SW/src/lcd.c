@@ -45,12 +45,35 @@ extern uint8_t				g_SmartLCD_mode;
 extern gfx_coord_t			g_lcd_pencil_x;
 extern gfx_coord_t			g_lcd_pencil_y;
 extern char					g_strbuf[48];
+extern uint16_t				g_lcd_bench_10us[LCD_BENCH__COUNT];
 
 
 #define ANIMATION_TRAIN_WAGGON_CNT		4
 #define ANIMATION_TRAIN_BLANK_LEN       (1 + 15 + ANIMATION_TRAIN_WAGGON_CNT * (3 + 8) + 1)
 
 static uint8_t s_lcd_ram_read_nonvalid = 0;
+static uint8_t s_lcd_shadow_page = LCD_SHADOW_INVALID;				// Shadow of the controller's page address
+static uint8_t s_lcd_shadow_col  = LCD_SHADOW_INVALID;				// Shadow of the controller's column address
+static uint16_t s_lcd_dirty_pages = 0;								// Pages written to since the last clear
+static uint8_t s_lcd_dirty_min[GFX_MONO_LCD_PAGES];					// First column written to, per page
+static uint8_t s_lcd_dirty_max[GFX_MONO_LCD_PAGES];					// Last column written to, per page
+static uint8_t s_lcd_dirty_valid = false;							// Dirty tracking valid - RAM is undefined after power-up
+static uint8_t s_lcd_mapping = C_LCD_MAPPING;						// Current MY/MX mapping of the controller
+static uint8_t s_lcd_effect_bm = 0;									// Display effects set permanently
+static uint8_t s_lcd_blink_bm = 0;									// Display effects toggled by the blinker
+static uint8_t s_lcd_blink_period = 0;								// Blink phase length in TC2 ticks
+static uint8_t s_lcd_blink_ctr = 0;									// TC2 ticks left in the current phase
+static uint16_t s_lcd_blink_phases = 0;								// Phases left, 0xffff: endless
+static uint8_t s_lcd_blink_state = 0;								// Blinker effects currently applied
+static lcd_defer_t s_lcd_defer_queue[LCD_DEFER_QUEUE_LEN];			// Bus operations requested from interrupt context
+static uint8_t s_lcd_defer_head = 0;
+static uint8_t s_lcd_defer_tail = 0;
+static uint8_t s_lcd_restart_pending = false;						// LCD_DEFER_OP_RESTART taken from the queue, run by lcd_restart_run()
+static uint8_t s_lcd_restart_pattern = 0;							// Test pattern of the pending restart
+static uint8_t s_lcd_console_top  = 0;								// Ring index of the topmost visible console line
+static uint8_t s_lcd_console_rows = 0;								// Count of console lines in use
+static uint8_t s_lcd_console_col  = 0;								// Column of the next console character
+static uint8_t s_lcd_header_col   = 0;								// Column of the next header character
 static	int    s_animation_train_origin = 0;
 static 	int8_t s_animation_dx = 0;
 static float   s_animation_time_last_temp  = 0.f;
@@ -62,34 +85,131 @@ static uint8_t s_animation_train_right[ANIMATION_TRAIN_BLANK_LEN];
 // hold a copy of a font size in the PROG memory section
 SYSFONT_DEFINE_GLYPHS;
 
+// enable sequence streamed by lcd_enable() - Gain and PM are sent before by lcd_contrast_update()
+static PROGMEM_DECLARE(uint8_t, s_lcd_power_cmds[]) = {
+	0b00101000 | C_LCD_PWR_CTRL,									// Set Power Control
+	0b00100000 | C_LCD_MR_TC,										// Set MR and TC
+	0b11101000 | C_LCD_BIASRATIO									// Set Bias Ratio
+};
+
+static PROGMEM_DECLARE(uint8_t, s_lcd_enable_cmds[]) = {
+	0b11000000 | C_LCD_MAPPING,										// Set Mapping
+	0b10001000 | C_LCD_AC,											// Set RAM Address Control
+	0b01000000,														// Set Start Line (0)
+	0b10010000,														// Set Fixed Lines (0)
+	0b10110000,														// Set Page Address (0)
+	0b00000000,														// Set Column Address LSB (0)
+	0b00010000,														// Set Column Address MSB (0)
+	0b11101111,														// Set Cursor Mode
+	0b11101110,														// Reset Cursor Mode (now CR := CA)
+	0b10100100,														// Disable DC[1] (all pixel on)
+	0b10100110,														// Disable DC[0] (all pixel inverse)
+	0b10101111														// Enable  DC[2] (Display)
+};
+
+
+static void s_lcd_shadow_invalidate(void)
+{
+	s_lcd_shadow_page = LCD_SHADOW_INVALID;
+	s_lcd_shadow_col  = LCD_SHADOW_INVALID;
+	s_lcd_ram_read_nonvalid = true;
+}
 
-uint8_t lcd_bus_read_status(void)
+static void s_lcd_dirty_all(void)
 {
-	uint8_t data;
-	irqflags_t flags = cpu_irq_save();
+	s_lcd_dirty_pages = 0xffff;
+	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
+		s_lcd_dirty_min[page] = 0;
+		s_lcd_dirty_max[page] = GFX_MONO_LCD_WIDTH - 1;
+	}
+}
 
-	PORTD = 0xff;													// Enable pull-ups (when bus-drivers are disabled)
-	DDRD  = 0x00;													// Disable bus-drivers
-	ioport_set_pin_level(LCD_CD, false);							// Select command-interface
-	ioport_set_pin_level(LCD_RW, true);								// Bus-read
-	ioport_set_pin_level(LCD_EN, true);								// Bus-enable
-	ioport_set_pin_level(LCD_EN, false);							// Bus-disable
-	data = PIND;													// Access needs 50ns: therefore take 2 cycles with 33ns each
+static void s_lcd_dirty_mark(uint16_t cnt)
+{
+	uint8_t page = s_lcd_shadow_page;
+	uint8_t col  = s_lcd_shadow_col;
 
-	cpu_irq_restore(flags);
-	return data;
+	if ((page == LCD_SHADOW_INVALID) || (col == LCD_SHADOW_INVALID) || (cnt >= GFX_MONO_LCD_FRAMEBUFFER_SIZE)) {
+		s_lcd_dirty_all();											// Target unknown or everything
+		return;
+	}
+
+	/* Follow the run through the pages as the address wrap-around does */
+	while (cnt) {
+		const uint16_t	room	= GFX_MONO_LCD_WIDTH - col;
+		const uint8_t	last	= (cnt < room) ?  (col + cnt - 1) : (GFX_MONO_LCD_WIDTH - 1);
+		const uint16_t	page_bm	= 1U << page;
+
+		if (!(s_lcd_dirty_pages & page_bm)) {
+			s_lcd_dirty_pages |= page_bm;
+			s_lcd_dirty_min[page] = col;
+			s_lcd_dirty_max[page] = last;
+
+		} else {
+			if (col  < s_lcd_dirty_min[page]) {
+				s_lcd_dirty_min[page] = col;
+			}
+			if (last > s_lcd_dirty_max[page]) {
+				s_lcd_dirty_max[page] = last;
+			}
+		}
+
+		cnt -= (last - col) + 1;
+		col   = 0;
+		page  = (page + 1) % GFX_MONO_LCD_PAGES;
+	}
+}
+
+static void s_lcd_shadow_col_written(const uint8_t *src, uint16_t cnt, uint8_t type)
+{
+	/* Every RAM write path passes here before the address moves on */
+	LCD_STATS_ADD(LCD_STATS_RAM_WR, cnt);
+	s_lcd_dirty_mark(cnt);
+	gfx_mono_lcd_uc1608_cache_written(s_lcd_shadow_page, s_lcd_shadow_col, src, cnt, type);
+
+	/* Writes have no pipeline: CA auto-increments once per byte and wraps around into the next page (C_LCD_AC) */
+	if (s_lcd_shadow_col != LCD_SHADOW_INVALID) {
+		uint16_t col = s_lcd_shadow_col + cnt;
+
+		while (col >= GFX_MONO_LCD_WIDTH) {
+			col -= GFX_MONO_LCD_WIDTH;
+			if (s_lcd_shadow_page != LCD_SHADOW_INVALID) {
+				s_lcd_shadow_page = (s_lcd_shadow_page + 1) % GFX_MONO_LCD_PAGES;
+			}
+		}
+		s_lcd_shadow_col = (uint8_t) col;
+	}
+
+	/* The read pipeline does not follow write accesses */
+	s_lcd_ram_read_nonvalid = true;
+}
+
+static void s_lcd_shadow_col_read(uint8_t cnt)
+{
+	LCD_STATS_ADD(LCD_STATS_RAM_RD, cnt);
+
+	/* The two-stage read pipeline runs ahead of the data returned - do not trust CA after reads.
+	 * When the run (plus dummy and pre-fetch) may have reached the end of the page, PA may have wrapped, too */
+	if ((s_lcd_shadow_col == LCD_SHADOW_INVALID) || ((s_lcd_shadow_col + cnt + 2) >= GFX_MONO_LCD_WIDTH)) {
+		s_lcd_shadow_page = LCD_SHADOW_INVALID;
+	}
+	s_lcd_shadow_col = LCD_SHADOW_INVALID;
 }
 
-void lcd_bus_write_cmd(uint8_t cmd)
+
+void lcd_bus_write_cmd_burst_P(const uint8_t *src_P, uint8_t len)
 {
+	if (!src_P || !len) {
+		return;
+	}
+
 	irqflags_t flags = cpu_irq_save();
 
-	PORTD = cmd;													// Data to be written
-	DDRD  = 0xff;													// Enable bus-drivers
-	ioport_set_pin_level(LCD_CD, false);							// Select command-interface
-	ioport_set_pin_level(LCD_RW, false);							// Bus-write
-	ioport_set_pin_level(LCD_EN, true);								// Bus-enable
-	ioport_set_pin_level(LCD_EN, false);							// Bus-disable
+	lcd_bus_setup_write(false);
+	LCD_STATS_ADD(LCD_STATS_CMD_WR, len);
+	do {
+		lcd_bus_strobe_write(PROGMEM_READ_BYTE(src_P++));
+	} while (--len);
 
 	cpu_irq_restore(flags);
 }
@@ -98,41 +218,200 @@ void lcd_bus_write_ram(uint8_t data)
 {
 	irqflags_t flags = cpu_irq_save();
 
-	PORTD = data;													// Data to be written
-	DDRD  = 0xff;													// Enable bus-drivers
-	ioport_set_pin_level(LCD_CD, true);								// Select RAM-interface
-	ioport_set_pin_level(LCD_RW, false);							// Bus-write
-	ioport_set_pin_level(LCD_EN, true);								// Bus-enable
-	ioport_set_pin_level(LCD_EN, false);							// Bus-disable
+	lcd_bus_setup_write(true);
+	lcd_bus_strobe_write(data);
+
+	s_lcd_shadow_col_written(&data, 1, GFX_MONO_LCD_UC1608_CACHE_SRC_RAM);
 
 	cpu_irq_restore(flags);
 }
 
+/* The burst gain over lcd_bus_write_ram() loops is estimated from the instruction count only,
+ * it is not yet measured on target - see LCD_BENCH_PAGE_WRITE and LCD_BENCH_CLS of lcd_benchmark() */
+void lcd_bus_write_ram_burst(const uint8_t *src, uint16_t len)
+{
+	if (!src) {
+		return;
+	}
+	s_lcd_shadow_col_written(src, len, GFX_MONO_LCD_UC1608_CACHE_SRC_RAM);
+
+	while (len) {
+		uint8_t cnt = (len > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : (uint8_t) len;
+		len -= cnt;
+
+		irqflags_t flags = cpu_irq_save();							// Interrupts are blocked for one chunk only
+
+		lcd_bus_setup_write(true);
+		do {
+			lcd_bus_strobe_write(*(src++));
+		} while (--cnt);
+
+		cpu_irq_restore(flags);
+	}
+}
+
+void lcd_bus_write_ram_burst_P(const uint8_t *src_P, uint16_t len)
+{
+	if (!src_P) {
+		return;
+	}
+	s_lcd_shadow_col_written(src_P, len, GFX_MONO_LCD_UC1608_CACHE_SRC_PROGMEM);
+
+	while (len) {
+		uint8_t cnt = (len > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : (uint8_t) len;
+		len -= cnt;
+
+		irqflags_t flags = cpu_irq_save();							// Interrupts are blocked for one chunk only
+
+		lcd_bus_setup_write(true);
+		do {
+			lcd_bus_strobe_write(PROGMEM_READ_BYTE(src_P++));
+		} while (--cnt);
+
+		cpu_irq_restore(flags);
+	}
+}
+
+void lcd_bus_fill_ram(uint8_t val, uint16_t len)
+{
+	s_lcd_shadow_col_written(&val, len, GFX_MONO_LCD_UC1608_CACHE_SRC_FILL);
+
+	while (len) {
+		uint8_t cnt = (len > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : (uint8_t) len;
+		len -= cnt;
+
+		irqflags_t flags = cpu_irq_save();							// Interrupts are blocked for one chunk only
+
+		lcd_bus_setup_write(true);
+		PORTD = val;												// Data stays on the bus for the whole chunk
+		do {
+			lcd_bus_strobe();
+		} while (--cnt);
+
+		cpu_irq_restore(flags);
+	}
+}
+
 uint8_t lcd_bus_read_ram(void)
 {
 	uint8_t data;
 	irqflags_t flags = cpu_irq_save();
 
-	PORTD = 0xff;													// Enable pull-ups (when bus-drivers are disabled)
-	DDRD  = 0x00;													// Disable bus-drivers
-	ioport_set_pin_level(LCD_CD, true);								// Select RAM-interface
-	ioport_set_pin_level(LCD_RW, true);								// Bus-read
-	ioport_set_pin_level(LCD_EN, true);								// Bus-enable
-	ioport_set_pin_level(LCD_EN, false);							// Bus-disable
-
+	lcd_bus_setup_read(true);
 	if (s_lcd_ram_read_nonvalid) {
-		data = PIND;												// Discard void data from pipeline
-		ioport_set_pin_level(LCD_EN, true);							// Bus-enable
-		ioport_set_pin_level(LCD_EN, false);						// Bus-disable
+		lcd_bus_strobe();											// Discard void data from pipeline
+		LCD_STATS_ADD(LCD_STATS_RAM_RD_DUMMY, 1);
 	}
-	data = PIND;													// Access needs 50ns: therefore take 2 cycles with 33ns each
+	data = lcd_bus_strobe_read();
 
 	s_lcd_ram_read_nonvalid = false;								// since here read returns valid data
+	s_lcd_shadow_col_read(1);
 
 	cpu_irq_restore(flags);
 	return data;
 }
 
+void lcd_bus_read_ram_burst(uint8_t *dst, uint8_t len)
+{
+	if (!dst) {
+		return;
+	}
+	s_lcd_shadow_col_read(len);
+
+	while (len) {
+		uint8_t cnt = (len > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : len;
+		len -= cnt;
+
+		irqflags_t flags = cpu_irq_save();							// Interrupts are blocked for one chunk only
+
+		lcd_bus_setup_read(true);
+		if (s_lcd_ram_read_nonvalid) {
+			lcd_bus_strobe();										// Void data of the pipeline discarded once per run
+			s_lcd_ram_read_nonvalid = false;
+			LCD_STATS_ADD(LCD_STATS_RAM_RD_DUMMY, 1);
+		}
+		do {
+			*(dst++) = lcd_bus_strobe_read();
+		} while (--cnt);
+
+		cpu_irq_restore(flags);
+	}
+}
+
+static void s_lcd_rmw_span(uint8_t page, uint8_t col, const uint8_t *masks, uint8_t mask_step, uint8_t n, uint8_t op, uint8_t keep_mask)
+{
+	uint8_t buf[LCD_BUS_BURST_CHUNK];
+
+	if (!masks || (page >= GFX_MONO_LCD_PAGES) || (col >= GFX_MONO_LCD_WIDTH)) {
+		return;
+	}
+
+	/* Stay within the page - CA would wrap around into the next page (C_LCD_AC) */
+	if (n > (GFX_MONO_LCD_WIDTH - col)) {
+		n = GFX_MONO_LCD_WIDTH - col;
+	}
+
+	while (n) {
+		const uint8_t cnt = (n > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : n;
+
+		/* One burst read with a single dummy read - or from the shadow pages */
+		gfx_mono_get_page(buf, page, col, cnt);
+
+		/* Masks advance by mask_step - 0: the same mask for all columns */
+		const uint8_t *m = masks;
+		switch (op) {
+			case GFX_PIXEL_CLR:
+				for (uint8_t i = 0; i < cnt; ++i, m += mask_step) {
+					buf[i] &= ~*m;
+				}
+				break;
+
+			case GFX_PIXEL_SET:
+				for (uint8_t i = 0; i < cnt; ++i, m += mask_step) {
+					buf[i] |=  *m;
+				}
+				break;
+
+			case GFX_PIXEL_XOR:
+				for (uint8_t i = 0; i < cnt; ++i, m += mask_step) {
+					buf[i] ^=  *m;
+				}
+				break;
+
+			case LCD_RMW_OP_MERGE:
+				/* Bits of keep_mask stay, all others are taken from the data */
+				for (uint8_t i = 0; i < cnt; ++i, m += mask_step) {
+					buf[i] = (buf[i] & keep_mask) | (*m & ~keep_mask);
+				}
+				break;
+		}
+
+		/* Re-address the column once and write the run back */
+		lcd_page_set(page);
+		lcd_col_set(col);
+		lcd_bus_write_ram_burst(buf, cnt);
+
+		masks	+= mask_step ?  cnt : 0;
+		col		+= cnt;
+		n		-= cnt;
+	}
+}
+
+void lcd_rmw_span(uint8_t page, uint8_t col, const uint8_t *masks, uint8_t n, gfx_mono_color_t op)
+{
+	s_lcd_rmw_span(page, col, masks, 1, n, op, 0);
+}
+
+void lcd_rmw_span_const(uint8_t page, uint8_t col, uint8_t mask, uint8_t n, gfx_mono_color_t op)
+{
+	s_lcd_rmw_span(page, col, &mask, 0, n, op, 0);
+}
+
+void lcd_merge_span(uint8_t page, uint8_t col, const uint8_t *data, uint8_t keep_mask, uint8_t n)
+{
+	s_lcd_rmw_span(page, col, data, 1, n, LCD_RMW_OP_MERGE, keep_mask);
+}
+
 
 uint8_t lcd_bounds_x(int x)
 {
@@ -168,75 +447,332 @@ void lcd_enable(uint8_t on)
 		lcd_bus_write_cmd(0b10101110);								// Disable DC[2] (Display)
 
 	} else {
-		lcd_bus_write_cmd(0b00101000 | C_LCD_PWR_CTRL);				// Set Power Control
-		lcd_bus_write_cmd(0b00100000 | C_LCD_MR_TC);				// Set MR and TC
-		lcd_bus_write_cmd(0b11101000 | C_LCD_BIASRATIO);			// Set Bias Ratio
+		lcd_bus_write_cmd_burst_P(s_lcd_power_cmds, sizeof(s_lcd_power_cmds));
 		lcd_contrast_update();
+		lcd_bus_write_cmd_burst_P(s_lcd_enable_cmds, sizeof(s_lcd_enable_cmds));
 
-		lcd_bus_write_cmd(0b11000000 | C_LCD_MAPPING);				// Set Mapping
-		lcd_bus_write_cmd(0b10001000 | C_LCD_AC);					// Set RAM Address Control
+		/* State set by the sequence */
+		s_lcd_mapping = C_LCD_MAPPING;
+		s_lcd_shadow_page = 0;
+		s_lcd_shadow_col  = 0;
+		s_lcd_ram_read_nonvalid = true;
 
-		lcd_bus_write_cmd(0b01000000);								// Set Start Line (0)
-		lcd_bus_write_cmd(0b10010000);								// Set Fixed Lines (0)
+		irqflags_t flags = cpu_irq_save();
+		s_lcd_effect_bm = 0;
+		s_lcd_blink_bm = 0;
+		cpu_irq_restore(flags);
+	}
+}
 
-		lcd_bus_write_cmd(0b10110000);								// Set Page Address (0)
-		lcd_bus_write_cmd(0b00000000);								// Set Column Address LSB (0)
-		lcd_bus_write_cmd(0b00010000);								// Set Column Address MSB (0)
-		s_lcd_ram_read_nonvalid = true;
+static void s_lcd_effect_update(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	const uint8_t effect_bm = s_lcd_effect_bm ^ (s_lcd_blink_state ?  s_lcd_blink_bm : 0);
+	cpu_irq_restore(flags);
+
+	lcd_bus_write_cmd(0b10100110 | ((effect_bm & LCD_EFFECT_INVERSE) ?  1 : 0));	// DC[0] (all pixel inverse)
+	lcd_bus_write_cmd(0b10100100 | ((effect_bm & LCD_EFFECT_ALL_ON)  ?  1 : 0));	// DC[1] (all pixel on)
+}
+
+void lcd_effect_set(uint8_t effect_bm, uint8_t on)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	if (on) {
+		s_lcd_effect_bm |=  effect_bm;
+	} else {
+		s_lcd_effect_bm &= ~effect_bm;
+	}
+	s_lcd_blink_bm = 0;												// A steady setting stops the blinker
+
+	cpu_irq_restore(flags);
+
+	lcd_defer(LCD_DEFER_OP_EFFECT, 0);
+}
+
+void lcd_effect_blink(uint8_t effect_bm, uint8_t period_10ms, uint8_t count)
+{
+	/* Phase length in TC2 ticks - 122 equals to one second */
+	uint16_t l_period = (122U * period_10ms) / 100;
+
+	irqflags_t flags = cpu_irq_save();
+
+	s_lcd_blink_bm		= (period_10ms && count) ?  effect_bm : 0;
+	s_lcd_blink_period	= l_period ?  (l_period < 0xff ?  l_period : 0xff) : 1;
+	s_lcd_blink_ctr		= s_lcd_blink_period;
+	s_lcd_blink_phases	= (count == LCD_EFFECT_BLINK_ENDLESS) ?  0xffff : (2U * count);
+	s_lcd_blink_state	= true;										// First phase starts now
+
+	if (s_lcd_blink_phases && (s_lcd_blink_phases != 0xffff)) {
+		--s_lcd_blink_phases;
+	}
+
+	cpu_irq_restore(flags);
+
+	lcd_defer(LCD_DEFER_OP_EFFECT, 0);
+}
 
-		lcd_bus_write_cmd(0b11101111);								// Set Cursor Mode
-		lcd_bus_write_cmd(0b11101110);								// Reset Cursor Mode (now CR := CA)
-		lcd_bus_write_cmd(0b10100100);								// Disable DC[1] (all pixel on)
-		lcd_bus_write_cmd(0b10100110);								// Disable DC[0] (all pixel inverse)
-		lcd_bus_write_cmd(0b10101111);								// Enable  DC[2] (Display)
+void lcd_effect_blink_tick(void)
+{
+	/* Called by the TC2 overflow ISR - the panel is updated by the task */
+	irqflags_t flags = cpu_irq_save();
+
+	if (s_lcd_blink_bm && !--s_lcd_blink_ctr) {
+		s_lcd_blink_ctr = s_lcd_blink_period;
+
+		if (s_lcd_blink_phases) {
+			if (s_lcd_blink_phases != 0xffff) {
+				--s_lcd_blink_phases;
+			}
+			s_lcd_blink_state = !s_lcd_blink_state;
+
+		} else {
+			s_lcd_blink_bm = 0;										// Done - back to the steady setting
+		}
+
+		cpu_irq_restore(flags);
+		lcd_defer(LCD_DEFER_OP_EFFECT, 0);
+		return;
+	}
+
+	cpu_irq_restore(flags);
+}
+
+void lcd_rotate_180(uint8_t on)
+{
+	uint8_t l[LCD_BUS_BURST_CHUNK];
+	uint8_t r[LCD_BUS_BURST_CHUNK];
+
+	if (!on == ((s_lcd_mapping & C_LCD_MAPPING_ROT180_BM) == (C_LCD_MAPPING & C_LCD_MAPPING_ROT180_BM))) {
+		return;														// Already there
+	}
+	gfx_mono_lcd_uc1608_cache_clear();								// Mirror the pending pixels of the display cache, too
+
+	/* Without a valid dirty tracking any page may hold content since power-up */
+	if (!s_lcd_dirty_valid) {
+		s_lcd_dirty_all();
+	}
+
+	/* MX applies to RAM accesses coming after, only - mirror each page in place first */
+	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
+		if (!(s_lcd_dirty_pages & (1U << page))) {
+			continue;												// Blank page, nothing to mirror
+		}
+
+		for (uint8_t col = 0, len; col < (GFX_MONO_LCD_WIDTH / 2); col += len) {
+			const uint8_t col_r = GFX_MONO_LCD_WIDTH - col;
+
+			len = (((GFX_MONO_LCD_WIDTH / 2) - col) > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : ((GFX_MONO_LCD_WIDTH / 2) - col);
+
+			gfx_mono_get_page(l, page, col, len);
+			gfx_mono_get_page(r, page, col_r - len, len);
+
+			for (uint8_t i = 0, j = len - 1; i < j; ++i, --j) {
+				uint8_t t;
+				t = l[i];  l[i] = l[j];  l[j] = t;
+				t = r[i];  r[i] = r[j];  r[j] = t;
+			}
+
+			lcd_stream_window(col, page, col + len - 1, page, r);
+			lcd_stream_window(col_r - len, page, col_r - 1, page, l);
+		}
+	}
+
+	/* MY flips the COM scan direction of the whole panel at once */
+	s_lcd_mapping ^= C_LCD_MAPPING_ROT180_BM;
+	lcd_bus_write_cmd(0b11000000 | s_lcd_mapping);					// Set Mapping
+	gfx_mono_lcd_uc1608_cache_clear();								// Cached the mirrored content of the passes above
+}
+
+uint8_t lcd_defer(uint8_t op, uint8_t arg)
+{
+	uint8_t ret = 0;
+	irqflags_t flags = cpu_irq_save();
+
+	/* Coalesce with a pending request of the same kind - its state is taken when executed */
+	for (uint8_t idx = s_lcd_defer_tail; idx != s_lcd_defer_head; idx = (idx + 1) % LCD_DEFER_QUEUE_LEN) {
+		if ((s_lcd_defer_queue[idx].op == op) && (s_lcd_defer_queue[idx].arg == arg)) {
+			cpu_irq_restore(flags);
+			return 0;
+		}
+	}
+
+	const uint8_t next = (s_lcd_defer_head + 1) % LCD_DEFER_QUEUE_LEN;
+	if (next != s_lcd_defer_tail) {
+		s_lcd_defer_queue[s_lcd_defer_head].op	= op;
+		s_lcd_defer_queue[s_lcd_defer_head].arg	= arg;
+		s_lcd_defer_head = next;
+
+	} else {
+		ret = 1;													// Queue full - request lost
 	}
+
+	cpu_irq_restore(flags);
+	return ret;
+}
+
+void lcd_defer_drain(void)
+{
+	/* Called by the task only: the LCD bus is owned by the main thread */
+	for (;;) {
+		lcd_defer_t l_op;
+
+		irqflags_t flags = cpu_irq_save();
+		if (s_lcd_defer_tail == s_lcd_defer_head) {
+			cpu_irq_restore(flags);
+			return;
+		}
+
+		l_op = s_lcd_defer_queue[s_lcd_defer_tail];
+		if ((l_op.op == LCD_DEFER_OP_MODE) && (s_lcd_restart_pending || !g_status.isAnimationStopped)) {
+			/* Kept queued until the animation has stopped - the task sets up the screen at the stop */
+			g_status.doAnimation = false;
+			cpu_irq_restore(flags);
+			return;
+		}
+		s_lcd_defer_tail = (s_lcd_defer_tail + 1) % LCD_DEFER_QUEUE_LEN;
+		cpu_irq_restore(flags);
+
+		switch (l_op.op) {
+			case LCD_DEFER_OP_CONTRAST:
+				lcd_contrast_update();
+			break;
+
+			case LCD_DEFER_OP_EFFECT:
+				s_lcd_effect_update();
+			break;
+
+			case LCD_DEFER_OP_RESTART:
+				/* The drain may run within the animation loop: let it finish first, the main loop restarts */
+				s_lcd_restart_pattern = l_op.arg;
+				s_lcd_restart_pending = true;
+
+				flags = cpu_irq_save();
+				g_status.doAnimation = false;
+				cpu_irq_restore(flags);
+			break;
+
+			case LCD_DEFER_OP_MODE:
+				lcd_mode_setup(l_op.arg);
+			break;
+
+#if LCD_STATS
+			case LCD_DEFER_OP_STATS_RESET:
+				/* Cleared by the main thread: its non-atomic counter updates cannot overwrite the reset */
+				flags = cpu_irq_save();
+				for (uint8_t idx = 0; idx < LCD_STATS__COUNT; ++idx) {
+					g_lcd_stats[idx] = 0;
+				}
+				cpu_irq_restore(flags);
+			break;
+#endif
+		}
+	}
+}
+
+void lcd_restart_run(void)
+{
+	/* Called by the main loop only, never by the task: the animation loops do not nest */
+	if (!s_lcd_restart_pending) {
+		return;
+	}
+	s_lcd_restart_pending = false;
+
+	lcd_init();
+	lcd_test(s_lcd_restart_pattern);
 }
 
 void lcd_page_set(uint8_t page)
 {
-	if ((0 <= page) && (page < GFX_MONO_LCD_PAGES)) {
+	if ((0 <= page) && (page < GFX_MONO_LCD_PAGES) && (page != s_lcd_shadow_page)) {
 		lcd_bus_write_cmd(0b10110000 | page);						// Set Page Address
 
+		s_lcd_shadow_page = page;
 		s_lcd_ram_read_nonvalid = 1;
 	}
 }
 
 void lcd_col_set(uint8_t col)
 {
-	if ((0 <= col) && (col < GFX_MONO_LCD_WIDTH)) {
+	if ((0 <= col) && (col < GFX_MONO_LCD_WIDTH) && (col != s_lcd_shadow_col)) {
 		lcd_bus_write_cmd(0b00000000 | ( col       & 0x0f));		// Set Column Address LSB
 		lcd_bus_write_cmd(0b00010000 | ((col >> 4) & 0x0f));		// Set Column Address MSB
 
+		s_lcd_shadow_col = col;
 		s_lcd_ram_read_nonvalid = 1;
 	}
 }
 
 void lcd_cr(void)
 {
-	lcd_bus_write_cmd(0b00000000);									// Set Column Address LSB (0)
-	lcd_bus_write_cmd(0b00010000);									// Set Column Address MSB (0)
-
-	s_lcd_ram_read_nonvalid = 1;
+	lcd_col_set(0);
 }
 
 void lcd_home(void)
 {
-	lcd_bus_write_cmd(0b10110000);									// Set Page Address (0)
+	lcd_page_set(0);
 	lcd_cr();
 }
 
+static void s_lcd_stream_window(uint8_t x0, uint8_t page0, uint8_t x1, uint8_t page1, const uint8_t *src, bool isProgmem)
+{
+	if (!src ||
+		(x0 > x1)		|| (x1		>= GFX_MONO_LCD_WIDTH) ||
+		(page0 > page1)	|| (page1	>= GFX_MONO_LCD_PAGES)) {
+		return;
+	}
+
+	const uint8_t  width = x1 - x0 + 1;
+	const uint16_t len   = (width == GFX_MONO_LCD_WIDTH) ?  (uint16_t)width * (page1 - page0 + 1) : width;
+
+	/* The UC1608 has no column window: only full-width blocks wrap into the next page by themselves */
+	for (uint8_t page = page0; page <= page1; ++page) {
+		lcd_page_set(page);
+		lcd_col_set(x0);
+
+		if (isProgmem) {
+			lcd_bus_write_ram_burst_P(src, len);
+		} else {
+			lcd_bus_write_ram_burst(src, len);
+		}
+
+		if (len > width) {
+			break;													// All pages done with one burst
+		}
+		src += width;
+	}
+}
+
+void lcd_stream_window(uint8_t x0, uint8_t page0, uint8_t x1, uint8_t page1, const uint8_t *src)
+{
+	s_lcd_stream_window(x0, page0, x1, page1, src, false);
+}
+
+void lcd_stream_window_P(uint8_t x0, uint8_t page0, uint8_t x1, uint8_t page1, const uint8_t *src_P)
+{
+	s_lcd_stream_window(x0, page0, x1, page1, src_P, true);
+}
+
 void lcd_cls(void)
 {
-	/* Blank LCD RAM */
-	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
-		lcd_bus_write_cmd(0b10110000 | page);						// Set Page Address
-		lcd_bus_write_cmd(0b00000000);								// Set Column Address LSB (0)
-		lcd_bus_write_cmd(0b00010000);								// Set Column Address MSB (0)
+	/* Pending pixels of the display cache are written before to keep the dirty tracking exact */
+	gfx_mono_lcd_uc1608_cache_flush();
 
-		for (uint8_t cnt = GFX_MONO_LCD_WIDTH; cnt; --cnt) {		// Clear all columns of that page
-			lcd_bus_write_ram(0);
+	/* Blank the dirty column ranges only - full width pages in a row need no new address setup due to wrap-around */
+	if (!s_lcd_dirty_valid) {
+		s_lcd_dirty_all();
+	}
+	const uint16_t dirty_pages = s_lcd_dirty_pages;
+
+	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
+		if (dirty_pages & (1U << page)) {
+			lcd_page_set(page);
+			lcd_col_set(s_lcd_dirty_min[page]);
+			lcd_bus_fill_ram(0, (s_lcd_dirty_max[page] - s_lcd_dirty_min[page]) + 1);
 		}
 	}
+	s_lcd_dirty_pages = 0;
+	s_lcd_dirty_valid = true;
 
 	/* Set cursor to home position */
 	lcd_home();
@@ -260,6 +796,25 @@ void lcd_write(const char *strbuf, gfx_coord_t pos_x, gfx_coord_t pos_y)
 	}
 }
 
+void lcd_mode_setup(uint8_t mode)
+{
+	/* Scrolling and fixed lines of the console are reset for all other modes */
+	lcd_console_enable(false);
+	lcd_cls();
+
+	if (mode == C_SMART_LCD_MODE_REFOSC) {
+		/* Come up with the data presenter for the 10 MHz-Ref.-Osc. */
+		gfx_mono_generic_draw_rect(0, 0, 240, 128, GFX_PIXEL_SET);
+		const char buf[] = "<==== 10 MHz.-Ref.-Osc. Smart-LCD ====>";
+		gfx_mono_draw_string(buf, 3, 2, &sysfont);
+		lcd_show_template();
+
+	} else if (mode == C_SMART_LCD_MODE_CONSOLE) {
+		/* Fixed header line and scrolling console below */
+		lcd_console_enable(true);
+	}
+}
+
 
 void lcd_show_template(void)
 {
@@ -350,50 +905,50 @@ static void lcd_show_new_clk_state(uint8_t clk_state, uint16_t phaseVolt1000, in
 	gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 33 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP + 11 * LCD_SHOW_LINE_HEIGHT, &sysfont);
 
 	if ((clk_state_old != clk_state) || !dx) {
-		gfx_mono_generic_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  (maxdiff << 1) +8, 5, GFX_PIXEL_CLR);
+		gfx_mono_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  (maxdiff << 1) +8, 5, GFX_PIXEL_CLR);
 	}
 
 	if (dx) {
 		switch (clk_state) {
 			case 0xf:
-				gfx_mono_generic_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  maxdiff + ldiff +4, 5, GFX_PIXEL_CLR);
+				gfx_mono_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  maxdiff + ldiff +4, 5, GFX_PIXEL_CLR);
 				if (diff < 0) {
-					gfx_mono_generic_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   ox,     LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,
 											   GFX_PIXEL_SET);
-					gfx_mono_generic_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   ox,     LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 5,
 											   GFX_PIXEL_SET);
 				}
-				gfx_mono_generic_draw_filled_rect(ox, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1, dx, 5, GFX_PIXEL_SET);
-				gfx_mono_generic_draw_filled_rect(mid_x + rdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  maxdiff - rdiff +4, 5, GFX_PIXEL_CLR);
+				gfx_mono_draw_filled_rect(ox, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1, dx, 5, GFX_PIXEL_SET);
+				gfx_mono_draw_filled_rect(mid_x + rdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,  maxdiff - rdiff +4, 5, GFX_PIXEL_CLR);
 				if (diff > 0) {
-					gfx_mono_generic_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   mid_x + rdiff - 1, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,
 											   GFX_PIXEL_SET);
-					gfx_mono_generic_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   mid_x + rdiff - 1, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 5,
 											   GFX_PIXEL_SET);
 				}
 			break;
 
 			case 0x7:
-				gfx_mono_generic_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  maxdiff + ldiff +4, 3, GFX_PIXEL_CLR);
+				gfx_mono_draw_filled_rect(mid_x - maxdiff -4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  maxdiff + ldiff +4, 3, GFX_PIXEL_CLR);
 				if (diff < 0) {
-					gfx_mono_generic_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   ox,     LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,
 											   GFX_PIXEL_SET);
-					gfx_mono_generic_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(ox - 4, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   ox,     LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 4,
 											   GFX_PIXEL_SET);
 				}
-				gfx_mono_generic_draw_filled_rect(ox, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  dx, 3, GFX_PIXEL_SET);
-				gfx_mono_generic_draw_filled_rect(mid_x + rdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  maxdiff - rdiff +4, 3, GFX_PIXEL_CLR);
+				gfx_mono_draw_filled_rect(ox, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  dx, 3, GFX_PIXEL_SET);
+				gfx_mono_draw_filled_rect(mid_x + rdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,  maxdiff - rdiff +4, 3, GFX_PIXEL_CLR);
 				if (diff > 0) {
-					gfx_mono_generic_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   mid_x + rdiff - 1, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 2,
 											   GFX_PIXEL_SET);
-					gfx_mono_generic_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
+					gfx_mono_draw_line(mid_x + rdiff + 3, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,
 											   mid_x + rdiff - 1, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 4,
 											   GFX_PIXEL_SET);
 				}
@@ -402,12 +957,12 @@ static void lcd_show_new_clk_state(uint8_t clk_state, uint16_t phaseVolt1000, in
 			case 0x3:
 			case 0x2:
 			case 0x1:
-				gfx_mono_generic_draw_filled_rect(mid_x - maxdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,  maxdiff << 1, 1, GFX_PIXEL_SET);
+				gfx_mono_draw_filled_rect(mid_x - maxdiff, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 3,  maxdiff << 1, 1, GFX_PIXEL_SET);
 			break;
 		}
 
 	} else {
-		gfx_mono_generic_draw_line( mid_x, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,
+		gfx_mono_draw_line( mid_x, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 1,
 									mid_x, LCD_SHOW_LINE_TOP + 12 * LCD_SHOW_LINE_HEIGHT + 5,
 									GFX_PIXEL_SET);
 	}
@@ -427,7 +982,6 @@ uint8_t lcd_show_new_smartlcd_data(void)
 
 	switch (g_showData.cmd) {
 		case TWI_SMART_LCD_CMD_RESET:
-			gfx_mono_lcd_uc1608_cache_clear();
 			lcd_reset();
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
@@ -435,7 +989,6 @@ uint8_t lcd_show_new_smartlcd_data(void)
 		break;
 
 		case TWI_SMART_LCD_CMD_CLS:
-			gfx_mono_lcd_uc1608_cache_clear();
 			lcd_cls();
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
@@ -466,7 +1019,6 @@ uint8_t lcd_show_new_smartlcd_data(void)
 			l_pencil_x = g_showData.pencil_x;
 			l_pencil_y = g_showData.pencil_y;
 			lcd_write(buf, l_pencil_x, l_pencil_y);
-			gfx_mono_lcd_uc1608_cache_clear();
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
 			return TWI_SMART_LCD_CMD_WRITE;
@@ -481,8 +1033,7 @@ uint8_t lcd_show_new_smartlcd_data(void)
 			if (l_pixelType == 255) {
 				l_pixelType = g_showData.pixelType;
 			}
-			gfx_mono_generic_draw_line(l_pencil_x, l_pencil_y, l_to_x, l_to_y, l_pixelType);
-			gfx_mono_lcd_uc1608_cache_clear();
+			gfx_mono_draw_line(l_pencil_x, l_pencil_y, l_to_x, l_to_y, l_pixelType);
 			g_showData.pencil_x = l_to_x;
 			g_showData.pencil_y = l_to_y;
 			g_showData.cmd = 0;
@@ -500,7 +1051,6 @@ uint8_t lcd_show_new_smartlcd_data(void)
 				l_pixelType = g_showData.pixelType;
 			}
 			gfx_mono_generic_draw_rect(l_pencil_x, l_pencil_y, l_width, l_height, l_pixelType);
-			gfx_mono_lcd_uc1608_cache_clear();
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
 			return TWI_SMART_LCD_CMD_DRAW_RECT;
@@ -515,8 +1065,7 @@ uint8_t lcd_show_new_smartlcd_data(void)
 			if (l_pixelType == 255) {
 				l_pixelType = g_showData.pixelType;
 			}
-			gfx_mono_generic_draw_filled_rect(l_pencil_x, l_pencil_y, l_width, l_height, l_pixelType);
-			gfx_mono_lcd_uc1608_cache_clear();
+			gfx_mono_draw_filled_rect(l_pencil_x, l_pencil_y, l_width, l_height, l_pixelType);
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
 			return TWI_SMART_LCD_CMD_DRAW_FILLED_RECT;
@@ -530,8 +1079,7 @@ uint8_t lcd_show_new_smartlcd_data(void)
 			if (l_pixelType == 255) {
 				l_pixelType = g_showData.pixelType;
 			}
-			gfx_mono_generic_draw_circle(l_pencil_x, l_pencil_y, l_radius, l_pixelType, GFX_QUADRANT0 | GFX_QUADRANT1 | GFX_QUADRANT2 | GFX_QUADRANT3);
-			gfx_mono_lcd_uc1608_cache_clear();
+			gfx_mono_draw_circle(l_pencil_x, l_pencil_y, l_radius, l_pixelType, GFX_QUADRANT0 | GFX_QUADRANT1 | GFX_QUADRANT2 | GFX_QUADRANT3);
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
 			return TWI_SMART_LCD_CMD_DRAW_CIRC;
@@ -545,12 +1093,25 @@ uint8_t lcd_show_new_smartlcd_data(void)
 			if (l_pixelType == 255) {
 				l_pixelType = g_showData.pixelType;
 			}
-			gfx_mono_generic_draw_filled_circle(l_pencil_x, l_pencil_y, l_radius, l_pixelType, GFX_QUADRANT0 | GFX_QUADRANT1 | GFX_QUADRANT2 | GFX_QUADRANT3);
-			gfx_mono_lcd_uc1608_cache_clear();
+			gfx_mono_draw_filled_circle(l_pencil_x, l_pencil_y, l_radius, l_pixelType, GFX_QUADRANT0 | GFX_QUADRANT1 | GFX_QUADRANT2 | GFX_QUADRANT3);
 			g_showData.cmd = 0;
 			cpu_irq_restore(flags);
 			return TWI_SMART_LCD_CMD_DRAW_FILLED_CIRC;
 		break;
+
+		case TWI_SMART_LCD_CMD_SET_ROTATION:						// Rotate content and drawing by 180 degrees - no redraw needed
+			lcd_rotate_180(g_showData.data[0] & 0x01);
+			g_showData.cmd = 0;
+			cpu_irq_restore(flags);
+			return TWI_SMART_LCD_CMD_SET_ROTATION;
+		break;
+
+		case TWI_SMART_LCD_CMD_BENCHMARK:							// Time the bus and drawing primitives - needs the timer interrupts running
+			g_showData.cmd = 0;
+			cpu_irq_restore(flags);
+			lcd_benchmark();
+			return TWI_SMART_LCD_CMD_BENCHMARK;
+		break;
 	}
 
 	cpu_irq_restore(flags);
@@ -572,7 +1133,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.time_hour, g_showData.time_minute, g_showData.time_second);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  2 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		return 255;
 	}
 
@@ -583,7 +1143,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.date_day, g_showData.date_month, g_showData.date_year);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  1 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		return 254;
 	}
 
@@ -592,7 +1151,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.newClkState = false;
 		cpu_irq_restore(flags);
 		lcd_show_new_clk_state(g_showData.clkState_clk_state, g_showData.clkState_phaseVolt1000, g_showData.clkState_phaseDeg100);
-		gfx_mono_lcd_uc1608_cache_clear();
 		return 253;
 	}
 
@@ -604,7 +1162,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.satUse_west, g_showData.satUse_east, g_showData.satUse_used);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 15 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  6 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 2;
 		return 1;
 	}
@@ -616,7 +1173,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		(int) (g_showData.satDop_dop100 / 100.0f), g_showData.satDop_dop100 % 100);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  7 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 3;
 		return 2;
 	}
@@ -628,7 +1184,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.posState_fi, g_showData.posState_m2);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 13 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  8 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 4;
 		return 3;
 	}
@@ -640,7 +1195,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.posLat_sgn, g_showData.posLat_deg, 0x7e, g_showData.posLat_min_int, g_showData.posLat_min_frac10000);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  9 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 5;
 		return 4;
 	}
@@ -652,7 +1206,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.posLon_sgn, g_showData.posLon_deg, 0x7e, g_showData.posLon_min_int, g_showData.posLon_min_frac10000);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP + 10 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 6;
 		return 5;
 	}
@@ -664,7 +1217,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.pos_height_int, g_showData.pos_height_frac10);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP + 11 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 7;
 		return 6;
 	}
@@ -676,7 +1228,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.ppb_int, g_showData.ppb_frac1000);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  3 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 8;
 		return 7;
 	}
@@ -699,7 +1250,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		snprintf(g_strbuf, sizeof(g_strbuf), "%3d.%03d",
 		(int) f_pwm, (int) ((f_pwm - floorf(f_pwm)) * 1000.0f));
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 23 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  4 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 9;
 		return 8;
 	}
@@ -711,7 +1261,6 @@ uint8_t lcd_show_new_refosc_data(void)
 		g_showData.pv_int, g_showData.pv_frac1000);
 		cpu_irq_restore(flags);
 		gfx_mono_draw_string(g_strbuf, LCD_SHOW_LINE_LEFT + 10 * LCD_SHOW_CLMN_WIDTH,  LCD_SHOW_LINE_TOP +  5 * LCD_SHOW_LINE_HEIGHT, &sysfont);
-		gfx_mono_lcd_uc1608_cache_clear();
 		idx = 10;
 		return 9;
 	}
@@ -724,6 +1273,209 @@ uint8_t lcd_show_new_refosc_data(void)
 }
 
 
+static uint8_t s_lcd_console_page(uint8_t ring_idx)
+{
+	return LCD_CONSOLE_HEADER_PAGES + ring_idx;
+}
+
+static void s_lcd_console_putc(uint8_t page, uint8_t col, char c)
+{
+	uint8_t cols[GFX_MONO_LCD_PIXELS_PER_BYTE];
+
+	if ((c < sysfont.first_char) || (c > sysfont.last_char)) {
+		c = ' ';
+	}
+
+	if (gfx_mono_lcd_uc1608_glyph_columns(c, &sysfont, cols)) {
+		lcd_stream_window(col, page, col + sysfont.width - 1, page, cols);
+	}
+}
+
+static void s_lcd_console_clear_page(uint8_t page)
+{
+	lcd_page_set(page);
+	lcd_cr();
+	lcd_bus_fill_ram(0, GFX_MONO_LCD_WIDTH);
+}
+
+static void s_lcd_console_start_line(void)
+{
+	/* Scrolls the lines below the fixed lines, only */
+	lcd_bus_write_cmd(0b01000000 | (s_lcd_console_top * GFX_MONO_LCD_PIXELS_PER_BYTE));	// Set Start Line
+}
+
+static void s_lcd_console_rebase(void)
+{
+	/* The start line register is too short for the whole ring: rotate the ring pages
+	 * in place so that the topmost line moves to ring index 0 again. Each cycle of the
+	 * permutation is walked column chunk by column chunk with two small buffers.
+	 */
+	uint8_t keep[LCD_BUS_BURST_CHUNK];
+	uint8_t move[LCD_BUS_BURST_CHUNK];
+
+	for (uint8_t col = 0, len; col < GFX_MONO_LCD_WIDTH; col += len) {
+		uint8_t done = 0;
+
+		len = ((GFX_MONO_LCD_WIDTH - col) > LCD_BUS_BURST_CHUNK) ?  LCD_BUS_BURST_CHUNK : (GFX_MONO_LCD_WIDTH - col);
+
+		for (uint8_t start = 0; done < LCD_CONSOLE_PAGES; ++start) {
+			uint8_t dst = start;
+
+			gfx_mono_get_page(keep, s_lcd_console_page(start), col, len);
+			for (;;) {
+				uint8_t src = dst + s_lcd_console_top;
+				if (src >= LCD_CONSOLE_PAGES) {
+					src -= LCD_CONSOLE_PAGES;
+				}
+				if (src == start) {
+					break;
+				}
+
+				gfx_mono_get_page(move, s_lcd_console_page(src), col, len);
+				lcd_stream_window(col, s_lcd_console_page(dst), col + len - 1, s_lcd_console_page(dst), move);
+				dst = src;
+				++done;
+			}
+			lcd_stream_window(col, s_lcd_console_page(dst), col + len - 1, s_lcd_console_page(dst), keep);
+			++done;
+		}
+	}
+
+	s_lcd_console_top = 0;
+}
+
+static void s_lcd_console_newline(void)
+{
+	s_lcd_console_col = 0;
+
+	if (s_lcd_console_rows < LCD_CONSOLE_PAGES) {
+		/* Screen not filled yet - the line below is blank already */
+		++s_lcd_console_rows;
+		return;
+	}
+
+	/* The line scrolled out at the top becomes the new bottom line */
+	s_lcd_console_clear_page(s_lcd_console_page(s_lcd_console_top));
+
+	if (++s_lcd_console_top >= LCD_CONSOLE_PAGES) {
+		s_lcd_console_top = 0;
+	}
+	if ((s_lcd_console_top * GFX_MONO_LCD_PIXELS_PER_BYTE) > LCD_CONSOLE_START_LINE_MAX) {
+		s_lcd_console_rebase();
+	}
+
+	s_lcd_console_start_line();
+}
+
+void lcd_console_enable(uint8_t on)
+{
+	/* The caller clears the screen */
+	s_lcd_console_top  = 0;
+	s_lcd_console_rows = 1;
+	s_lcd_console_col  = 0;
+	s_lcd_header_col   = 0;
+
+	lcd_bus_write_cmd(0b10010000 | (on ?  LCD_CONSOLE_FIXED_LINES : 0));	// Set Fixed Lines
+	s_lcd_console_start_line();
+}
+
+void lcd_console_header(const char *strbuf, uint8_t len)
+{
+	if (!strbuf) {
+		return;
+	}
+
+	while (len--) {
+		const char c = *(strbuf++);
+
+		if ((c == '\r') || (c == '\n')) {
+			/* Start the header line over */
+			for (uint8_t page = 0; page < LCD_CONSOLE_HEADER_PAGES; ++page) {
+				s_lcd_console_clear_page(page);
+			}
+			s_lcd_header_col = 0;
+			continue;
+		}
+
+		if ((s_lcd_header_col + sysfont.width) <= GFX_MONO_LCD_WIDTH) {
+			s_lcd_console_putc(0, s_lcd_header_col, c);
+			s_lcd_header_col += sysfont.width;
+		}
+	}
+}
+
+void lcd_console_write(const char *strbuf, uint8_t len)
+{
+	if (!strbuf) {
+		return;
+	}
+
+	while (len--) {
+		const char c = *(strbuf++);
+
+		if (c == '\n') {
+			s_lcd_console_newline();
+			continue;
+
+		} else if (c == '\r') {
+			s_lcd_console_col = 0;
+			continue;
+		}
+
+		if ((s_lcd_console_col + sysfont.width) > GFX_MONO_LCD_WIDTH) {
+			s_lcd_console_newline();								// Line wrap
+		}
+
+		if (!s_lcd_console_rows) {
+			s_lcd_console_rows = 1;									// Console not enabled yet: start with the first line
+		}
+
+		uint8_t ring_idx = s_lcd_console_top + s_lcd_console_rows - 1;
+		if (ring_idx >= LCD_CONSOLE_PAGES) {
+			ring_idx -= LCD_CONSOLE_PAGES;
+		}
+		s_lcd_console_putc(s_lcd_console_page(ring_idx), s_lcd_console_col, c);
+		s_lcd_console_col += sysfont.width;
+	}
+}
+
+uint8_t lcd_show_new_console_data(void)
+{
+	char buf[TWI_SMART_LCD_SLAVE_BUF_LEN];
+	uint8_t cmd;
+	uint8_t len;
+
+	/* Take the data and release the TWI buffer before the panel is accessed */
+	irqflags_t flags = cpu_irq_save();
+	cmd = g_showData.cmd;
+	len = g_showData.data[0];
+	if (len >= sizeof(buf)) {
+		len = 0;
+	}
+	for (uint8_t i = 0; i < len; ++i) {
+		buf[i] = g_showData.data[1 + i];
+	}
+	g_showData.cmd = 0;
+	cpu_irq_restore(flags);
+
+	switch (cmd) {
+		case TWI_SMART_LCD_CMD_CLS:
+			lcd_cls();
+			lcd_console_enable(true);
+		break;
+
+		case TWI_SMART_LCD_CMD_CONSOLE_HEADER:
+			lcd_console_header(buf, len);
+		break;
+
+		case TWI_SMART_LCD_CMD_CONSOLE_WRITE:
+			lcd_console_write(buf, len);
+		break;
+	}
+
+	return cmd;
+}
+
 static void s_lcd_test_lines(void)
 {
 	const int oy = 10;
@@ -736,12 +1488,12 @@ static void s_lcd_test_lines(void)
 	if (loop++ < h) {
 		uint8_t y11 = oy + loop;
 		uint8_t y12 = oy + h - loop - 1;
-		gfx_mono_generic_draw_line (0, y11, w - 1, y12, sw % 3);
+		gfx_mono_draw_line (0, y11, w - 1, y12, sw % 3);
 
 	} else if (loop < (h + w)) {
 		uint8_t x21 = (loop - h);
 		uint8_t x22 = w - (loop - h) - 1;
-		gfx_mono_generic_draw_line (x21, oy + h - 1, x22, oy, sw % 3);
+		gfx_mono_draw_line (x21, oy + h - 1, x22, oy, sw % 3);
 
 	} else {
 		loop = 0;
@@ -864,7 +1616,7 @@ void lcd_animation_prepare(void)
 	}
 
 	/* prepare free line for train */
-	gfx_mono_generic_draw_filled_rect(0, (GFX_MONO_LCD_PAGES - 1) * GFX_MONO_LCD_PIXELS_PER_BYTE, GFX_MONO_LCD_WIDTH, GFX_MONO_LCD_PIXELS_PER_BYTE, GFX_PIXEL_CLR);
+	gfx_mono_draw_filled_rect(0, (GFX_MONO_LCD_PAGES - 1) * GFX_MONO_LCD_PIXELS_PER_BYTE, GFX_MONO_LCD_WIDTH, GFX_MONO_LCD_PIXELS_PER_BYTE, GFX_PIXEL_CLR);
 }
 
 void lcd_animation_loop(void)
@@ -908,6 +1660,14 @@ void lcd_animation_loop(void)
 		}
 
 		task(now);													// calculate backlight PWM and temperature value
+
+		flags = cpu_irq_save();
+		l_doAnimation = g_status.doAnimation;						// The task may have set up the screen of a new mode
+		cpu_irq_restore(flags);
+		if (!l_doAnimation) {
+			break;
+		}
+
 		if ((now - s_animation_time_last_temp) >= 0.50f) {			// 2x per sec
 			s_animation_time_last_temp = now;
 			s_lcd_test_temp();
@@ -916,6 +1676,7 @@ void lcd_animation_loop(void)
 		}
 
 		s_lcd_test_lines();											// Every cycle
+		gfx_mono_put_framebuffer();									// Write back the pixels pending in the display cache
 
 		flags = cpu_irq_save();
 		l_doAnimation = g_status.doAnimation;						// TWI command TWI_SMART_LCD_CMD_SET_MODE can unset this flag
@@ -949,9 +1710,10 @@ void lcd_test(uint8_t pattern_bm)
 		// TEST 2
 		lcd_page_set(1);
 		lcd_cr();
-		for (int i = 0, pos = 231; i < GFX_MONO_LCD_WIDTH; ++i, ++pos) {
-			if (!(i % 7)) {
+		for (int i = 0, pos = 231, col = 0; col < GFX_MONO_LCD_WIDTH; ++i, ++pos, ++col) {	// Stop at the end of the page (wrap-around)
+			if (!(i % 7) && (col < GFX_MONO_LCD_WIDTH - 1)) {
 				lcd_bus_write_ram(0);
+				++col;
 			}
 			lcd_bus_write_ram(PROGMEM_READ_BYTE(&(sysfont_glyphs[pos])));
 		}
@@ -967,20 +1729,20 @@ void lcd_test(uint8_t pattern_bm)
 
 	if (pattern_bm & (1 << 3)) {
 		// TEST 4
-		gfx_mono_generic_draw_line (        10, 60 + 10, 40, 60 + 34, GFX_PIXEL_SET);
-		gfx_mono_generic_draw_line (        10, 60 + 34, 40, 60 + 10, GFX_PIXEL_SET);
+		gfx_mono_draw_line (                10, 60 + 10, 40, 60 + 34, GFX_PIXEL_SET);
+		gfx_mono_draw_line (                10, 60 + 34, 40, 60 + 10, GFX_PIXEL_SET);
 	}
 
 	if (pattern_bm & (1 << 4)) {
 		// TEST 5
 		gfx_mono_generic_draw_rect(          0, 60 +  0, 20, 20, GFX_PIXEL_SET);
-		gfx_mono_generic_draw_filled_rect(  30, 60 +  0, 20, 20, GFX_PIXEL_SET);
+		gfx_mono_draw_filled_rect(          30, 60 +  0, 20, 20, GFX_PIXEL_SET);
 	}
 
 	if (pattern_bm & (1 << 5)) {
 		// TEST 6
-		gfx_mono_generic_draw_filled_circle(10, 60 + 34, 10, GFX_PIXEL_SET, GFX_WHOLE);
-		gfx_mono_generic_draw_circle(       40, 60 + 34, 10, GFX_PIXEL_SET, GFX_WHOLE);
+		gfx_mono_draw_filled_circle(10, 60 + 34, 10, GFX_PIXEL_SET, GFX_WHOLE);
+		gfx_mono_draw_circle(       40, 60 + 34, 10, GFX_PIXEL_SET, GFX_WHOLE);
 	}
 
 	if (pattern_bm & (1 << 6)) {
@@ -998,6 +1760,9 @@ void lcd_test(uint8_t pattern_bm)
 		gfx_mono_draw_string("Buttons: . . .  00000:0 -",	70, 58 +  4 *10, &sysfont);
 	}
 
+	/* Write back the pixels pending in the display cache before the animation runs */
+	gfx_mono_put_framebuffer();
+
 	if (pattern_bm & (1 << 7)) {
 		// TEST 8
 		lcd_animation_prepare();
@@ -1010,6 +1775,95 @@ void lcd_test(uint8_t pattern_bm)
 	}
 }
 
+static void s_lcd_benchmark_store(uint8_t idx, uint32_t ts_us)
+{
+	const uint32_t dt_us = get_abs_time_us() - ts_us;
+
+	g_lcd_bench_10us[idx] = (dt_us < 655350UL) ?  (uint16_t) (dt_us / 10) : 0xffff;
+}
+
+void lcd_benchmark(void)
+{
+	uint8_t buf[LCD_BUS_BURST_CHUNK];
+	uint32_t ts;
+
+	for (uint8_t idx = 0; idx < LCD_BENCH__COUNT; ++idx) {
+		g_lcd_bench_10us[idx] = 0;									// Not measured
+	}
+	gfx_mono_lcd_uc1608_cache_clear();
+
+	/* Full screen clear */
+	s_lcd_dirty_all();
+	ts = get_abs_time_us();
+	lcd_cls();
+	s_lcd_benchmark_store(LCD_BENCH_CLS, ts);
+
+	/* Page bursts: write and read back all pages */
+	ts = get_abs_time_us();
+	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
+		lcd_page_set(page);
+		lcd_cr();
+		lcd_bus_fill_ram(0x55, GFX_MONO_LCD_WIDTH);
+	}
+	s_lcd_benchmark_store(LCD_BENCH_PAGE_WRITE, ts);
+
+	ts = get_abs_time_us();
+	for (uint8_t page = 0; page < GFX_MONO_LCD_PAGES; ++page) {
+		lcd_page_set(page);
+		lcd_cr();
+		for (uint8_t col = 0, len; col < GFX_MONO_LCD_WIDTH; col += len) {
+			len = ((GFX_MONO_LCD_WIDTH - col) > sizeof(buf)) ?  sizeof(buf) : (GFX_MONO_LCD_WIDTH - col);
+			lcd_bus_read_ram_burst(buf, len);
+		}
+	}
+	s_lcd_benchmark_store(LCD_BENCH_PAGE_READ, ts);
+	lcd_cls();
+
+	/* Scalar RMW bytes: one page */
+	ts = get_abs_time_us();
+	for (uint8_t col = 0; col < GFX_MONO_LCD_WIDTH; ++col) {
+		gfx_mono_mask_byte(0, col, 0x81, GFX_PIXEL_XOR);
+	}
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_RMW, ts);
+	lcd_cls();
+
+	/* Glyphs: one text line of the full width */
+	ts = get_abs_time_us();
+	gfx_mono_draw_string("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ+-*/", 0, LCD_SHOW_LINE_TOP, &sysfont);
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_GLYPH, ts);
+	lcd_cls();
+
+	/* Lines: both diagonals - with the driver's line and with the generic pixel by pixel line */
+	ts = get_abs_time_us();
+	gfx_mono_draw_line(0, 0, GFX_MONO_LCD_WIDTH - 1, GFX_MONO_LCD_HEIGHT - 1, GFX_PIXEL_SET);
+	gfx_mono_draw_line(0, GFX_MONO_LCD_HEIGHT - 1, GFX_MONO_LCD_WIDTH - 1, 0, GFX_PIXEL_SET);
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_LINE, ts);
+	lcd_cls();
+
+	ts = get_abs_time_us();
+	gfx_mono_generic_draw_line(0, 0, GFX_MONO_LCD_WIDTH - 1, GFX_MONO_LCD_HEIGHT - 1, GFX_PIXEL_SET);
+	gfx_mono_generic_draw_line(0, GFX_MONO_LCD_HEIGHT - 1, GFX_MONO_LCD_WIDTH - 1, 0, GFX_PIXEL_SET);
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_LINE_GENERIC, ts);
+	lcd_cls();
+
+	/* Circles: outline and filled */
+	ts = get_abs_time_us();
+	gfx_mono_draw_circle(GFX_MONO_LCD_WIDTH / 2, GFX_MONO_LCD_HEIGHT / 2, LCD_BENCH_CIRC_RADIUS, GFX_PIXEL_SET, GFX_WHOLE);
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_CIRC, ts);
+	lcd_cls();
+
+	ts = get_abs_time_us();
+	gfx_mono_draw_filled_circle(GFX_MONO_LCD_WIDTH / 2, GFX_MONO_LCD_HEIGHT / 2, LCD_BENCH_CIRC_RADIUS, GFX_PIXEL_SET, GFX_WHOLE);
+	gfx_mono_put_framebuffer();
+	s_lcd_benchmark_store(LCD_BENCH_FILLED_CIRC, ts);
+	lcd_cls();
+}
+
 
 
 const void* lcd_get_sysfont(void)
@@ -1020,14 +1874,30 @@ const void* lcd_get_sysfont(void)
 
 uint8_t lcd_init(void)
 {
-	uint8_t data;
+	uint8_t data = C_LCD_STATUS_M | C_LCD_STATUS_RS_M;
+
+	/* The reset keeps the RAM content - in mirrored column order when rotated.
+	 * Pending pixels of the display cache are written before */
+	gfx_mono_lcd_uc1608_cache_clear();
+	if (s_lcd_mapping != C_LCD_MAPPING) {
+		s_lcd_dirty_all();
+	}
 
 	/* INIT sequence */
 	lcd_bus_write_cmd(0b11100010);									// Reset display
-	delay_ms(20);													// Wait for the panel to get ready in case one is attached to the bus
+	s_lcd_shadow_invalidate();										// Address registers are undefined now
+
+	/* Wait for the panel to get ready - no panel at the bus keeps BZ and RS (pull-ups) */
+	delay_ms(LCD_RESET_SETTLE_MS);									// The reset has to be under way before its status is valid
+	for (uint16_t cnt = LCD_RESET_POLL_CNT; cnt; --cnt) {
+		data = lcd_bus_read_status();								// Get current status
+		if (!(data & (C_LCD_STATUS_M | C_LCD_STATUS_RS_M))) {
+			break;
+		}
+		delay_us(LCD_RESET_POLL_US);
+	}
 
-	data = lcd_bus_read_status();									// Get current status
-	if (!(data & C_LCD_STATUS_M)) {
+	if (!(data & (C_LCD_STATUS_M | C_LCD_STATUS_RS_M))) {
 		/* LCD panel reacts correctly - resume with INIT sequence */
 		lcd_enable(true);
 		lcd_cls();													// Clear screen
@@ -1041,5 +1911,6 @@ uint8_t lcd_init(void)
 void lcd_shutdown(void)
 {
 	lcd_bus_write_cmd(0b11100010);									// Reset display
+	s_lcd_shadow_invalidate();
 	delay_ms(2);													// Wait for the energy to dissipate
 }
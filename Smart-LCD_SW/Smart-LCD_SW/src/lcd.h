@@ -14,6 +14,34 @@
 #include "gfx_mono/gfx_mono.h"
 
 
+// Statistics: bus, display cache and TWI counters - 0: compiled out
+#ifndef LCD_STATS
+#define LCD_STATS													0
+#endif
+
+enum LCD_STATS__ENUM {
+	LCD_STATS_CMD_WR												= 0,	// Command bytes written
+	LCD_STATS_RAM_WR,												// Data bytes written
+	LCD_STATS_RAM_RD,												// Data bytes read
+	LCD_STATS_RAM_RD_DUMMY,											// Dummy reads of the read pipeline
+	LCD_STATS_CACHE_HIT,											// Byte reads served by the display cache or the shadow pages
+	LCD_STATS_CACHE_MISS,											// Byte reads from the display device
+	LCD_STATS_TWI_CMDS,												// TWI commands received
+	LCD_STATS_TWI_BYTES,											// TWI bytes received with these commands (command and parameters)
+	LCD_STATS__COUNT
+};
+
+#if LCD_STATS
+/* Declared here as the inline bus accesses of lcd_bus.h count, too */
+extern uint32_t				g_lcd_stats[LCD_STATS__COUNT];
+# define LCD_STATS_ADD(idx, n)										(g_lcd_stats[(idx)] += (n))
+#else
+# define LCD_STATS_ADD(idx, n)
+#endif
+
+#include "lcd_bus.h"
+
+
 // MUX: 1 = 128; Power Control: 0b01 = 26nF .. 43nF
 #define C_LCD_PWR_CTRL												0b101
 
@@ -36,37 +64,130 @@
 // Mapping: no MY, no MX, 0, no MSF
 #define C_LCD_MAPPING												0b1000
 
-// Address Control: Page Address increment, no Wrap Around column/page
-#define C_LCD_AC													0b000
+// Mapping: bits toggled for a 180 degree rotation (MY, MX)
+#define C_LCD_MAPPING_ROT180_BM										0b1100
+
+// Address Control: Page Address increment, Wrap Around column/page (CA 239 --> 0 and PA + 1)
+#define C_LCD_AC													0b001
 
 // Status: BZ flag
 #define C_LCD_STATUS_M	_BV(7)
 
+// Status: RS flag - reset in progress, the host interface is not accessible
+#define C_LCD_STATUS_RS_M											_BV(4)
+
+// Reset: settling time before the first status poll, then BZ/RS polling interval and count - timeout after 20 ms
+#define LCD_RESET_SETTLE_MS											2
+#define LCD_RESET_POLL_US											50
+#define LCD_RESET_POLL_CNT											((20000 - (LCD_RESET_SETTLE_MS * 1000)) / LCD_RESET_POLL_US)
+
+// Display effects: DC[0] all pixel inverse, DC[1] all pixel on
+#define LCD_EFFECT_INVERSE											0x01
+#define LCD_EFFECT_ALL_ON											0x02
+
+// Display effects: endless blinking
+#define LCD_EFFECT_BLINK_ENDLESS									0xff
+
+// Address shadow: marker for an unknown page or column address of the controller
+#define LCD_SHADOW_INVALID											0xff
+
+// Burst transfers: max. count of bytes per interrupt-blocked chunk (1..255)
+#define LCD_BUS_BURST_CHUNK											32
+
+// Console: Fixed Lines FL counts two lines each - 4: the header page 0 does not scroll
+#define LCD_CONSOLE_FIXED_LINES										4
+#define LCD_CONSOLE_HEADER_PAGES									((2 * LCD_CONSOLE_FIXED_LINES) / GFX_MONO_LCD_PIXELS_PER_BYTE)
+#define LCD_CONSOLE_PAGES											(GFX_MONO_LCD_PAGES - LCD_CONSOLE_HEADER_PAGES)
+
+// Console: the Set Start Line command holds 6 bits
+#define LCD_CONSOLE_START_LINE_MAX									63
+
+// Benchmark: radius of the circles drawn
+#define LCD_BENCH_CIRC_RADIUS										60
+
+// Read/modify/write spans: operation beyond the pixel operations of gfx_mono_color_t - lcd_merge_span()
+#define LCD_RMW_OP_MERGE											0x10
+
+// Deferred bus operations: max. count of pending requests - 1
+#define LCD_DEFER_QUEUE_LEN											8
+
 #define LCD_SHOW_LINE_TOP											11
 #define LCD_SHOW_LINE_HEIGHT										9
 #define LCD_SHOW_LINE_LEFT											3
 #define LCD_SHOW_CLMN_WIDTH											6
 
 
-uint8_t	lcd_bus_read_status(void);
-void	lcd_bus_write_cmd(uint8_t cmd);
+uint8_t lcd_defer(uint8_t op, uint8_t arg);
+void	lcd_defer_drain(void);
+void	lcd_restart_run(void);
+
+enum LCD_DEFER_OP__ENUM {
+	LCD_DEFER_OP_NONE												= 0,
+	LCD_DEFER_OP_CONTRAST,											// lcd_contrast_update()
+	LCD_DEFER_OP_EFFECT,											// Display effects DC[1:0] from the current state
+	LCD_DEFER_OP_RESTART,											// lcd_init() and lcd_test(arg) - by lcd_restart_run()
+	LCD_DEFER_OP_MODE,												// lcd_mode_setup(arg) of the new Smart-LCD mode
+	LCD_DEFER_OP_STATS_RESET,										// Clear the statistics counters g_lcd_stats
+};
+
+typedef struct lcd_defer {
+	uint8_t		op;
+	uint8_t		arg;
+} lcd_defer_t;
+
+
+void	lcd_benchmark(void);
+
+enum LCD_BENCH__ENUM {
+	LCD_BENCH_CLS													= 0,	// lcd_cls() of the full screen
+	LCD_BENCH_PAGE_WRITE,											// Burst write of all pages
+	LCD_BENCH_PAGE_READ,											// Burst read of all pages
+	LCD_BENCH_RMW,													// Scalar mask operation on each byte of a page
+	LCD_BENCH_GLYPH,												// 40 characters of the system font
+	LCD_BENCH_LINE,													// Both diagonals of the screen
+	LCD_BENCH_CIRC,													// Circle outline of LCD_BENCH_CIRC_RADIUS
+	LCD_BENCH_FILLED_CIRC,											// Filled circle of LCD_BENCH_CIRC_RADIUS
+	LCD_BENCH_LINE_GENERIC,											// Both diagonals, pixel by pixel (reference of LCD_BENCH_LINE)
+	LCD_BENCH__COUNT
+};
+
+
+void	lcd_bus_write_cmd_burst_P(const uint8_t *src_P, uint8_t len);
 void	lcd_bus_write_ram(uint8_t data);
+void	lcd_bus_write_ram_burst(const uint8_t *src, uint16_t len);
+void	lcd_bus_write_ram_burst_P(const uint8_t *src_P, uint16_t len);
+void	lcd_bus_fill_ram(uint8_t val, uint16_t len);
 uint8_t lcd_bus_read_ram(void);
+void	lcd_bus_read_ram_burst(uint8_t *dst, uint8_t len);
+void	lcd_rmw_span(uint8_t page, uint8_t col, const uint8_t *masks, uint8_t n, gfx_mono_color_t op);
+void	lcd_rmw_span_const(uint8_t page, uint8_t col, uint8_t mask, uint8_t n, gfx_mono_color_t op);
+void	lcd_merge_span(uint8_t page, uint8_t col, const uint8_t *data, uint8_t keep_mask, uint8_t n);
 
 uint8_t lcd_bounds_x(int x);
 uint8_t lcd_bounds_y(int y);
 void	lcd_contrast_update(void);
 void    lcd_enable(uint8_t on);
+void    lcd_effect_set(uint8_t effect_bm, uint8_t on);
+void    lcd_effect_blink(uint8_t effect_bm, uint8_t period_10ms, uint8_t count);
+void    lcd_effect_blink_tick(void);
+void    lcd_rotate_180(uint8_t on);
 void    lcd_page_set(uint8_t page);
 void    lcd_col_set(uint8_t col);
 void    lcd_cr(void);
 void    lcd_home(void);
+void    lcd_stream_window(uint8_t x0, uint8_t page0, uint8_t x1, uint8_t page1, const uint8_t *src);
+void    lcd_stream_window_P(uint8_t x0, uint8_t page0, uint8_t x1, uint8_t page1, const uint8_t *src_P);
 void    lcd_cls(void);
 void	lcd_reset(void);
 void	lcd_write(const char *strbuf, gfx_coord_t pos_x, gfx_coord_t pos_y);
+void    lcd_mode_setup(uint8_t mode);
 void    lcd_show_template(void);
 uint8_t lcd_show_new_smartlcd_data(void);
 uint8_t lcd_show_new_refosc_data(void);
+void    lcd_console_enable(uint8_t on);
+void    lcd_console_header(const char *strbuf, uint8_t len);
+void    lcd_console_write(const char *strbuf, uint8_t len);
+uint8_t lcd_show_new_console_data(void);
 void    lcd_animation_prepare(void);
 void    lcd_animation_loop(void);
 void    lcd_test(uint8_t pattern_bm);
@@ -0,0 +1,117 @@
+/**
+ * \file
+ *
+ * \brief Static inline access to the 8 bit wide UC1608 databus (6800 mode)
+ *
+ */
+
+/*
+ * The control lines LCD_CD, LCD_RW and LCD_EN are resolved at compile time from the
+ * IOPORT pin numbers of the board definition. Each pin operation thereby becomes a
+ * single SBI/CBI instruction - independent of the optimization level and of the
+ * ioport service being folded by the compiler.
+ *
+ * Estimated cycles per bus access @ 8 MHz (call, IRQ lock and port setup included).
+ * The figures are summed up from the expected instruction sequence of the C code,
+ * they are not counted from the .lss listing of a build and not measured on target:
+ *
+ *   access                           out-of-line + ioport   inline + SBI/CBI
+ *   --------------------------------------------------------------------------
+ *   lcd_bus_write_cmd()                      ~25                  ~15
+ *   lcd_bus_read_status()                    ~26                  ~16
+ *   lcd_bus_write_ram()                      ~32                  ~24   (shadow update remains out-of-line)
+ *   pin operation (-Os, folded)                2                    2
+ *   pin operation (-O0/-Og, not folded)       ~9                    2
+ *   burst write, per byte                    ~10                  ~10
+ *   burst fill,  per byte                     ~7                   ~7
+ */
+
+
+#ifndef LCD_BUS_H_
+#define LCD_BUS_H_
+
+#include <asf.h>
+
+
+/* Compile-time resolution of an IOPORT pin to its PORTx register and bit */
+#define LCD_BUS_PORTDATA(pin)		_SFR_IO8(((pin) >> 3) * IOPORT_PORT_OFFSET + 2)
+#define LCD_BUS_PIN_BM(pin)			_BV((pin) & 0x07)
+
+#define LCD_BUS_PIN_HIGH(pin)		(LCD_BUS_PORTDATA(pin) |=  LCD_BUS_PIN_BM(pin))
+#define LCD_BUS_PIN_LOW(pin)		(LCD_BUS_PORTDATA(pin) &= ~LCD_BUS_PIN_BM(pin))
+
+
+/* Bus setup - to be called with interrupts disabled */
+
+static inline void lcd_bus_setup_write(bool isRam)
+{
+	DDRD  = 0xff;													// Enable bus-drivers
+	if (isRam) {
+		LCD_BUS_PIN_HIGH(LCD_CD);									// Select RAM-interface
+	} else {
+		LCD_BUS_PIN_LOW(LCD_CD);									// Select command-interface
+	}
+	LCD_BUS_PIN_LOW(LCD_RW);										// Bus-write
+}
+
+static inline void lcd_bus_setup_read(bool isRam)
+{
+	PORTD = 0xff;													// Enable pull-ups (when bus-drivers are disabled)
+	DDRD  = 0x00;													// Disable bus-drivers
+	if (isRam) {
+		LCD_BUS_PIN_HIGH(LCD_CD);									// Select RAM-interface
+	} else {
+		LCD_BUS_PIN_LOW(LCD_CD);									// Select command-interface
+	}
+	LCD_BUS_PIN_HIGH(LCD_RW);										// Bus-read
+}
+
+
+/* Bus cycles - to be called after the matching setup */
+
+static inline void lcd_bus_strobe(void)
+{
+	LCD_BUS_PIN_HIGH(LCD_EN);										// Bus-enable
+	LCD_BUS_PIN_LOW(LCD_EN);										// Bus-disable
+}
+
+static inline void lcd_bus_strobe_write(uint8_t data)
+{
+	PORTD = data;													// Data to be written
+	lcd_bus_strobe();
+}
+
+static inline uint8_t lcd_bus_strobe_read(void)
+{
+	lcd_bus_strobe();
+	return PIND;													// Access needs 50ns: therefore take 2 cycles with 33ns each
+}
+
+
+/* Stateless single accesses */
+
+static inline uint8_t lcd_bus_read_status(void)
+{
+	uint8_t data;
+	irqflags_t flags = cpu_irq_save();
+
+	lcd_bus_setup_read(false);
+	data = lcd_bus_strobe_read();
+
+	cpu_irq_restore(flags);
+	return data;
+}
+
+static inline void lcd_bus_write_cmd(uint8_t cmd)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	lcd_bus_setup_write(false);
+	lcd_bus_strobe_write(cmd);
+	LCD_STATS_ADD(LCD_STATS_CMD_WR, 1);
+
+	cpu_irq_restore(flags);
+}
+
+
+#endif /* LCD_BUS_H_ */
@@ -67,6 +67,11 @@ gfx_coord_t			g_lcd_pencil_y						= 0;
 bool				g_led_red							= false;
 bool				g_led_green							= false;
 uint8_t				g_resetCause						= 0;
+uint16_t			g_boot_time_10us					= 0;
+uint16_t			g_lcd_bench_10us[LCD_BENCH__COUNT]	= { 0 };
+#if LCD_STATS
+uint32_t			g_lcd_stats[LCD_STATS__COUNT]		= { 0 };
+#endif
 char				g_strbuf[48]						= { 0 };
 
 
@@ -329,7 +334,7 @@ static void s_twi_disable(void)
 
 /* UTILITIES section */
 
-float get_abs_time(void)
+uint32_t get_abs_time_us(void)
 {
 	uint32_t now_us;
 	uint8_t l_tmr_l;
@@ -346,7 +351,12 @@ float get_abs_time(void)
 	now_us  = ((((uint16_t)l_tmr_h << 8) | l_tmr_l) >> 3);			// CPUclk = 8 MHz
 	now_us += l_tmr_100us * 100U;
 
-	return now_us * 1e-6f;
+	return now_us;
+}
+
+float get_abs_time(void)
+{
+	return get_abs_time_us() * 1e-6f;
 }
 
 void mem_set(uint8_t* buf, uint8_t count, uint8_t val)
@@ -500,6 +510,9 @@ void task(float timestamp)
 	/* Detect button pushes and rotary encoder settings */
 	s_task_buttons(l_portB, l_portC, timestamp);
 
+	/* LCD bus operations requested by the ISRs */
+	lcd_defer_drain();
+
 	/* Loops as long as more data is ready to be presented */
 	do {
 		more = 0;
@@ -517,31 +530,24 @@ void task(float timestamp)
 
 			} else if (l_SmartLCD_mode == C_SMART_LCD_MODE_REFOSC) {
 				more = lcd_show_new_refosc_data();
+
+			} else if (l_SmartLCD_mode == C_SMART_LCD_MODE_CONSOLE) {
+				more = lcd_show_new_console_data();
 			}
 		}
 
-		/* When transferring from animated demo to stopped animation */
-		if (!l_doAnimation) {
-			static int8_t s_last_animation = true;
-
-			if (s_last_animation) {
-				s_last_animation = false;
-
-				lcd_cls();
+		/* When transferring from animated demo to stopped animation - lcd_test() re-arms for each animation run */
+		if (!l_doAnimation && !l_isAnimationStopped && (l_SmartLCD_mode != C_SMART_LCD_MODE_UNIQUE)) {
+			/* Later mode changes are set up by the deferred LCD_DEFER_OP_MODE */
+			lcd_mode_setup(l_SmartLCD_mode);
 
-				if (l_SmartLCD_mode == C_SMART_LCD_MODE_REFOSC) {
-					/* Come up with the data presenter for the 10 MHz-Ref.-Osc. */
-					gfx_mono_generic_draw_rect(0, 0, 240, 128, GFX_PIXEL_SET);
-					const char buf[] = "<==== 10 MHz.-Ref.-Osc. Smart-LCD ====>";
-					gfx_mono_draw_string(buf, 3, 2, lcd_get_sysfont());
-					lcd_show_template();
-				}
-
-				flags = cpu_irq_save();
-				g_status.isAnimationStopped = true;
-				cpu_irq_restore(flags);
-			}
+			flags = cpu_irq_save();
+			g_status.isAnimationStopped = true;
+			cpu_irq_restore(flags);
 		}
+
+		/* Each command is a primitive of its own - write back the pixels pending in the display cache */
+		gfx_mono_put_framebuffer();
 	} while (more);
 }
 
@@ -606,6 +612,16 @@ int main (void)
 
 	/* Initialize external components */
 	lcd_init();
+
+	/* Boot-to-first-frame time since the timers started */
+	{
+		uint32_t l_boot_us = get_abs_time_us();
+
+		irqflags_t flags = cpu_irq_save();
+		g_boot_time_10us = (l_boot_us < 655350UL) ?  (uint16_t) (l_boot_us / 10) : 0xffff;
+		cpu_irq_restore(flags);
+	}
+
 	lcd_test(0b11111101);											// Debugging purposes
 
 
@@ -613,6 +629,7 @@ int main (void)
 	runmode = 1;
     while (runmode) {
 	    task(get_abs_time());
+	    lcd_restart_run();											// Restart requested by TWI_SMART_LCD_CMD_SET_MODE
 	    enter_sleep(SLEEP_MODE_IDLE);
     }
 
@@ -39,6 +39,7 @@ enum C_SMART_LCD_MODE__ENUM {
 	C_SMART_LCD_MODE_UNIQUE											= 0x00,
 	C_SMART_LCD_MODE_SMARTLCD										= 0x10,
 	C_SMART_LCD_MODE_REFOSC											= 0x20,
+	C_SMART_LCD_MODE_CONSOLE										= 0x30,
 };
 
 enum C_EEPROM_ADDR__ENUM {
@@ -128,6 +129,7 @@ typedef struct buttons_struct {
 
 
 /* UTILITIES section */
+uint32_t get_abs_time_us(void);
 float get_abs_time(void);
 void mem_set(uint8_t* buf, uint8_t count, uint8_t val);
 void eeprom_nvm_settings_write(uint8_t flags);
@@ -49,6 +49,8 @@ extern uint8_t				g_audio_out_length;
 extern status_t				g_status;
 extern uint32_t				g_rotenc_events;
 extern uint8_t				g_SmartLCD_mode;
+extern uint16_t				g_boot_time_10us;
+extern uint16_t				g_lcd_bench_10us[LCD_BENCH__COUNT];
 extern showData_t			g_showData;
 extern gfx_mono_color_t		g_lcd_pixel_type;
 extern gfx_coord_t			g_lcd_pencil_x;
@@ -76,11 +78,11 @@ static void s_isr_lcd_set_mode(int8_t mode)
 	g_SmartLCD_mode = mode;
 	if (mode) {
 		g_status.doAnimation = false;								// Stop animation demo
+		lcd_defer(LCD_DEFER_OP_MODE, mode);							// Screen setup of the new mode - done by the task
 
 		} else {
-		// Reset display
-		lcd_init();
-		lcd_test(0b11110001);										// Start animation again
+		// Reset display - done by the task
+		lcd_defer(LCD_DEFER_OP_RESTART, 0b11110001);				// Start animation again
 	}
 }
 
@@ -139,13 +141,23 @@ static void s_isr_smartlcd_cmd_set_backlight(uint8_t cmd, uint8_t mode, uint8_t
 static void s_isr_smartlcd_cmd_set_contrast(uint8_t cmd, uint8_t bias)
 {
 	g_lcd_contrast_pm = bias & 0x3f;
-	lcd_contrast_update();
+	lcd_defer(LCD_DEFER_OP_CONTRAST, 0);
 
 	if (bias & 0x80) {
 		eeprom_nvm_settings_write(C_EEPROM_NVM_SETTING_LCD_CONTRAST);
 	}
 }
 
+static void s_isr_smartlcd_cmd_set_effect(uint8_t cmd, uint8_t on)
+{
+	lcd_effect_set((cmd == TWI_SMART_LCD_CMD_SET_INVERSE) ?  LCD_EFFECT_INVERSE : LCD_EFFECT_ALL_ON, on & 0x01);
+}
+
+static void s_isr_smartlcd_cmd_set_blink(uint8_t cmd, uint8_t effect_bm, uint8_t period_10ms, uint8_t count)
+{
+	lcd_effect_blink(effect_bm & (LCD_EFFECT_INVERSE | LCD_EFFECT_ALL_ON), period_10ms, count);
+}
+
 
 static uint8_t s_isr_smartlcd_cmd_req_rotbut(uint8_t* data_out)
 {
@@ -198,6 +210,50 @@ static uint8_t s_isr_smartlcd_cmd_req_temp(uint8_t* data_out)
 	return 0;
 }
 
+static uint8_t s_isr_smartlcd_cmd_req_benchmark(uint8_t* data_out, uint8_t chunk)
+{
+	const uint8_t entries = TWI_SMART_LCD_SLAVE_RET_BUF_LEN >> 1;
+	uint8_t idx = chunk * entries;
+	uint8_t len = 0;
+
+	if (data_out && (chunk < ((LCD_BENCH__COUNT + entries - 1) / entries))) {
+		for (uint8_t i = 0; i < entries; ++i, ++idx) {
+			const uint16_t val = (idx < LCD_BENCH__COUNT) ?  g_lcd_bench_10us[idx] : 0;
+
+			data_out[len++] = (uint8_t) ( val       & 0xff);
+			data_out[len++] = (uint8_t) ((val >> 8) & 0xff);
+		}
+	}
+	return len;
+}
+
+
+#if LCD_STATS
+static uint8_t s_isr_smartlcd_cmd_req_stats(uint8_t* data_out, uint8_t param)
+{
+	const uint8_t entries = TWI_SMART_LCD_SLAVE_RET_BUF_LEN >> 2;
+	const uint8_t chunk = param & ~TWI_SMART_LCD_STATS_RESET;
+	uint8_t idx = chunk * entries;
+	uint8_t len = 0;
+
+	if (data_out && (chunk < ((LCD_STATS__COUNT + entries - 1) / entries))) {
+		for (uint8_t i = 0; i < entries; ++i, ++idx) {
+			const uint32_t val = (idx < LCD_STATS__COUNT) ?  g_lcd_stats[idx] : 0;
+
+			data_out[len++] = (uint8_t) ( val        & 0xff);
+			data_out[len++] = (uint8_t) ((val >>  8) & 0xff);
+			data_out[len++] = (uint8_t) ((val >> 16) & 0xff);
+			data_out[len++] = (uint8_t) ((val >> 24) & 0xff);
+		}
+	}
+
+	if (param & TWI_SMART_LCD_STATS_RESET) {
+		lcd_defer(LCD_DEFER_OP_STATS_RESET, 0);						// Cleared by the task
+	}
+	return len;
+}
+#endif
+
 
 static void s_isr_smartlcd_cmd(uint8_t cmd)
 {
@@ -288,6 +344,21 @@ static void s_isr_smartlcd_cmd_data14(uint8_t cmd, uint8_t data0, uint8_t data1,
 	g_showData.data[13] = data13;
 }
 
+static void s_isr_smartlcd_cmd_string(uint8_t cmd, const uint8_t data[])
+{
+	/* data[0]: length of the string, data[1..]: characters */
+	uint8_t len = data[0];
+
+	if (!len || (len > (TWI_SMART_LCD_SLAVE_BUF_LEN - 3))) {
+		return;
+	}
+
+	s_isr_smartlcd_cmd(cmd);
+	for (uint8_t i = 0; i <= len; ++i) {
+		g_showData.data[i] = data[i];
+	}
+}
+
 
 static void s_isr_lcd_10mhz_ref_osc_show_clkstate_phaseVolt1000_phaseDeg100(uint8_t clk_state, uint16_t phaseVolt1000, int16_t phaseDeg100)
 {
@@ -498,6 +569,9 @@ static void s_isr_twi_rcvd_command_closed_form(uint8_t data[], uint8_t cnt)
 	}  // if (isGCA)
 
 	else if ((data[0] == TWI_SLAVE_ADDR_SMARTLCD)) {
+		LCD_STATS_ADD(LCD_STATS_TWI_CMDS, 1);
+		LCD_STATS_ADD(LCD_STATS_TWI_BYTES, (cnt > 1) ?  (cnt - 1) : 0);
+
 		/* unique command section for all modes */
 		switch (cmd) {
 			case TWI_SMART_LCD_CMD_GET_VER:
@@ -514,6 +588,18 @@ static void s_isr_twi_rcvd_command_closed_form(uint8_t data[], uint8_t cnt)
 			s_rx_ret_len = 1;
 			return;
 
+			case TWI_SMART_LCD_CMD_GET_BOOTTIME:					// Boot-to-first-frame time: 2 bytes - x10us, LSB first
+			s_rx_ret_d[0] = (uint8_t) ( g_boot_time_10us       & 0xff);
+			s_rx_ret_d[1] = (uint8_t) ((g_boot_time_10us >> 8) & 0xff);
+			s_rx_ret_len = 2;
+			return;
+
+#if LCD_STATS
+			case TWI_SMART_LCD_CMD_GET_STATS:						// Statistics: 1 byte - chunk index | 0x80 reset afterwards - 2 counters, 4 bytes each, LSB first
+			s_rx_ret_len = s_isr_smartlcd_cmd_req_stats(s_rx_ret_d, data[2]);
+			return;
+#endif
+
 			default:
 			s_rx_ret_len = 0;
 		}
@@ -619,6 +705,19 @@ static void s_isr_twi_rcvd_command_closed_form(uint8_t data[], uint8_t cnt)
 						s_isr_smartlcd_cmd_data2(cmd, data[2], data[3]);
 					break;
 
+					case TWI_SMART_LCD_CMD_SET_ROTATION:			// Rotate display content and drawing: 1 byte - 0: normal, 1: 180 degrees
+						s_isr_smartlcd_cmd_data1(cmd, data[2]);
+					break;
+
+					case TWI_SMART_LCD_CMD_SET_INVERSE:				// Inverse display: 1 byte - 0: off, 1: on
+					case TWI_SMART_LCD_CMD_SET_ALL_ON:				// All pixels on (flash): 1 byte - 0: off, 1: on
+						s_isr_smartlcd_cmd_set_effect(cmd, data[2]);
+					break;
+
+					case TWI_SMART_LCD_CMD_SET_BLINK:				// Blink: 3 bytes - 0x01 inverse | 0x02 all on, phase length x10ms, count (0: stop, 255: endless)
+						s_isr_smartlcd_cmd_set_blink(cmd, data[2], data[3], data[4]);
+					break;
+
 					case TWI_SMART_LCD_CMD_GET_ROTBUT:				// State of rotary encoder and button: factor of 4 bytes each - 4bits per event - 0: I/Q down, 1: I/Q up, 2: button released, 3: button pressed | 4: another event follows | 8: event list overflowed.
 						s_rx_ret_len = s_isr_smartlcd_cmd_req_rotbut(s_rx_ret_d);
 						return;
@@ -634,6 +733,15 @@ static void s_isr_twi_rcvd_command_closed_form(uint8_t data[], uint8_t cnt)
 						return;
 					break;
 
+					case TWI_SMART_LCD_CMD_BENCHMARK:				// Run the LCD benchmark - clears the screen
+						s_isr_smartlcd_cmd(cmd);
+					break;
+
+					case TWI_SMART_LCD_CMD_GET_BENCHMARK:			// Request benchmark results: 1 byte chunk index - 4 entries x10us each, LSB first, 0: not measured
+						s_rx_ret_len = s_isr_smartlcd_cmd_req_benchmark(s_rx_ret_d, data[2]);
+						return;
+					break;
+
 					case TWI_SMART_LCD_CMD_SET_LEDS:				// LEDs: 1 byte - 0x01 red  0x02 green
 						s_isr_smartlcd_cmd_set_leds(cmd, data[2]);
 					break;
@@ -714,6 +822,35 @@ static void s_isr_twi_rcvd_command_closed_form(uint8_t data[], uint8_t cnt)
 				}
 			}  // switch (cmd)
 		}  // if (g_SmartLCD_mode == C_SMART_LCD_MODE_REFOSC)
+
+		else if (g_SmartLCD_mode == C_SMART_LCD_MODE_CONSOLE) {
+			if (!(g_showData.cmd)) {								// Do when no command in process only
+				switch (cmd) {
+					case TWI_SMART_LCD_CMD_CLS:						// Clear screen and header
+						s_isr_smartlcd_cmd(cmd);
+					break;
+
+					case TWI_SMART_LCD_CMD_SET_INVERSE:				// Inverse display: 1 byte - 0: off, 1: on
+					case TWI_SMART_LCD_CMD_SET_ALL_ON:				// All pixels on (flash): 1 byte - 0: off, 1: on
+						s_isr_smartlcd_cmd_set_effect(cmd, data[2]);
+					break;
+
+					case TWI_SMART_LCD_CMD_SET_BLINK:				// Blink: 3 bytes - 0x01 inverse | 0x02 all on, phase length x10ms, count (0: stop, 255: endless)
+						s_isr_smartlcd_cmd_set_blink(cmd, data[2], data[3], data[4]);
+					break;
+
+					case TWI_SMART_LCD_CMD_CONSOLE_WRITE:			// Append text of length (length, buffer...) - '\n' scrolls, '\r' returns
+					case TWI_SMART_LCD_CMD_CONSOLE_HEADER:			// Append text of length (length, buffer...) to the fixed header - '\r' clears
+						s_isr_smartlcd_cmd_string(cmd, &(data[2]));
+					break;
+
+					default:
+					{
+						// do nothing
+					}
+				}  // switch (cmd)
+			}  // if (!(g_showData.cmd))
+		}  // if (g_SmartLCD_mode == C_SMART_LCD_MODE_CONSOLE)
 	}  // if ((data[0] == TWI_SLAVE_ADDR_SMARTLCD))
 }
 
@@ -828,6 +965,7 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 						break;
 
 						case TWI_SMART_LCD_CMD_GET_TEMP:
+						case TWI_SMART_LCD_CMD_GET_BOOTTIME:
 							cnt_i = 1;
 							cnt_o = 2;
 						break;
@@ -837,10 +975,17 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 							cnt_o = 4;
 						break;
 
+						case TWI_SMART_LCD_CMD_GET_BENCHMARK:
+						case TWI_SMART_LCD_CMD_GET_STATS:
+							cnt_i = 2;
+							cnt_o = TWI_SMART_LCD_SLAVE_RET_BUF_LEN;
+						break;
+
 
 						case TWI_SMART_LCD_CMD_NOOP:
 						case TWI_SMART_LCD_CMD_RESET:
 						case TWI_SMART_LCD_CMD_CLS:
+						case TWI_SMART_LCD_CMD_BENCHMARK:
 						cnt_i = 1;
 						break;
 
@@ -848,6 +993,9 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 						case TWI_SMART_LCD_CMD_SET_PIXEL_TYPE:
 						case TWI_SMART_LCD_CMD_SET_LEDS:
 						case TWI_SMART_LCD_CMD_SET_CONTRAST:
+						case TWI_SMART_LCD_CMD_SET_INVERSE:
+						case TWI_SMART_LCD_CMD_SET_ALL_ON:
+						case TWI_SMART_LCD_CMD_SET_ROTATION:
 							cnt_i = 2;
 						break;
 
@@ -865,6 +1013,7 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 						case TWI_SMART_LCD_CMD_DRAW_LINE:
 						case TWI_SMART_LCD_CMD_DRAW_RECT:
 						case TWI_SMART_LCD_CMD_DRAW_FILLED_RECT:
+						case TWI_SMART_LCD_CMD_SET_BLINK:
 						case TWI_SMART_LCD_CMD_SHOW_HR_MIN_SEC:
 						case TWI_SMART_LCD_CMD_SHOW_POS_HEIGHT:
 						case TWI_SMART_LCD_CMD_SHOW_SATS:
@@ -884,6 +1033,8 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 						break;
 
 						case TWI_SMART_LCD_CMD_WRITE:
+						case TWI_SMART_LCD_CMD_CONSOLE_WRITE:
+						case TWI_SMART_LCD_CMD_CONSOLE_HEADER:
 							cnt_i = TWI_SMART_LCD_SLAVE_BUF_LEN;	// Max length of incoming data
 						break;
 					}
@@ -891,7 +1042,9 @@ uint8_t __vector_24__bottom(uint8_t tws, uint8_t twd, uint8_t twcr_cur)
 			}
 			else if (pos_i == 2) {
 				if (s_rx_d[0] == TWI_SLAVE_ADDR_SMARTLCD) {
-					if (s_rx_d[1] == TWI_SMART_LCD_CMD_WRITE) {
+					if ((s_rx_d[1] == TWI_SMART_LCD_CMD_WRITE) ||
+						(s_rx_d[1] == TWI_SMART_LCD_CMD_CONSOLE_WRITE) ||
+						(s_rx_d[1] == TWI_SMART_LCD_CMD_CONSOLE_HEADER)) {
 						/* Correct length of string to actual size */
 						uint8_t str_len = s_rx_d[2];
 						cnt_i = ((str_len <= (TWI_SMART_LCD_SLAVE_BUF_LEN - 2)) && (str_len < 0b1111)) ?  (str_len + 2) : 2;
@@ -22,6 +22,7 @@
 #define TWI_SMART_LCD_CMD_GET_VER									0x01
 #define TWI_SMART_LCD_CMD_SET_MODE									0x02
 #define TWI_SMART_LCD_CMD_GET_STATE									0x03
+#define TWI_SMART_LCD_CMD_GET_BOOTTIME								0x04
 
 // Mode 0x10 commands (Smart-LCD draw box)
 #define TWI_SMART_LCD_CMD_RESET										0x10
@@ -34,6 +35,13 @@
 #define TWI_SMART_LCD_CMD_DRAW_FILLED_RECT							0x36
 #define TWI_SMART_LCD_CMD_DRAW_CIRC									0x38
 #define TWI_SMART_LCD_CMD_DRAW_FILLED_CIRC							0x3A
+#define TWI_SMART_LCD_CMD_SET_INVERSE								0x40
+#define TWI_SMART_LCD_CMD_SET_ALL_ON								0x41
+#define TWI_SMART_LCD_CMD_SET_BLINK									0x42
+#define TWI_SMART_LCD_CMD_SET_ROTATION								0x43
+#define TWI_SMART_LCD_CMD_BENCHMARK									0x50
+#define TWI_SMART_LCD_CMD_GET_BENCHMARK								0x51
+#define TWI_SMART_LCD_CMD_GET_STATS									0x52
 #define TWI_SMART_LCD_CMD_GET_ROTBUT								0x60
 #define TWI_SMART_LCD_CMD_GET_LIGHT									0x64
 #define TWI_SMART_LCD_CMD_GET_TEMP									0x65
@@ -58,11 +66,18 @@
 #define TWI_SMART_LCD_CMD_SHOW_POS_LON								0x8C
 #define TWI_SMART_LCD_CMD_SHOW_POS_HEIGHT							0x8D
 
+// Mode 0x30 commands (Console) - TWI_SMART_LCD_CMD_CLS, _SET_INVERSE, _SET_ALL_ON and _SET_BLINK are accepted, also
+#define TWI_SMART_LCD_CMD_CONSOLE_WRITE								0x90
+#define TWI_SMART_LCD_CMD_CONSOLE_HEADER							0x91
+
 
 /* */
 #define TWI_SMART_LCD_MASTER_BUF_LEN								 8
 #define TWI_SMART_LCD_SLAVE_BUF_LEN									16
-#define TWI_SMART_LCD_SLAVE_RET_BUF_LEN								 2
+#define TWI_SMART_LCD_SLAVE_RET_BUF_LEN								 8
+
+/* GET_STATS parameter: chunk index | flag to reset all counters after reading */
+#define TWI_SMART_LCD_STATS_RESET									0x80
 
 
 /* TWI TWSR states after mask is applied */